@@ -59,6 +59,64 @@ namespace config {
             if (s.isMember("max_batch_uids")) out.storage.max_batch_uids = (std::size_t)s["max_batch_uids"].asUInt64();
         }
 
+        // net
+        if (root.isMember("net")) {
+            auto n = root["net"];
+            if (n.isMember("io_threads")) out.net.io_threads = n["io_threads"].asInt();
+            if (n.isMember("listen_backlog")) out.net.listen_backlog = n["listen_backlog"].asInt();
+            if (n.isMember("max_write_bytes")) out.net.max_write_bytes = (std::size_t)n["max_write_bytes"].asUInt64();
+            if (n.isMember("send_high_water_bytes")) out.net.send_high_water_bytes = (std::size_t)n["send_high_water_bytes"].asUInt64();
+            if (n.isMember("send_hard_limit_bytes")) out.net.send_hard_limit_bytes = (std::size_t)n["send_hard_limit_bytes"].asUInt64();
+        }
+
+        // log
+        if (root.isMember("log")) {
+            auto l = root["log"];
+            if (l.isMember("file")) out.log.file = l["file"].asString();
+            if (l.isMember("level")) out.log.level = l["level"].asString();
+            if (l.isMember("console")) out.log.console = l["console"].asBool();
+        }
+
+        // tick
+        if (root.isMember("tick")) {
+            auto t = root["tick"];
+            if (t.isMember("policy")) out.tick.policy = t["policy"].asString();
+            if (t.isMember("max_catch_up")) out.tick.max_catch_up = t["max_catch_up"].asInt();
+            if (t.isMember("spin_margin_us")) out.tick.spin_margin_us = t["spin_margin_us"].asInt();
+        }
+
+        // game
+        if (root.isMember("game")) {
+            auto g = root["game"];
+            if (g.isMember("worker_shards")) out.game.worker_shards = g["worker_shards"].asInt();
+        }
+
+        // field
+        if (root.isMember("field")) {
+            auto f = root["field"];
+            if (f.isMember("scheduler_threads")) out.field.scheduler_threads = f["scheduler_threads"].asInt();
+            if (f.isMember("bundle_events")) out.field.bundle_events = f["bundle_events"].asBool();
+            if (f.isMember("move_replication")) out.field.move_replication = f["move_replication"].asString();
+            if (f.isMember("move_correction_ms")) out.field.move_correction_ms = f["move_correction_ms"].asInt();
+            if (f.isMember("move_encoding")) out.field.move_encoding = f["move_encoding"].asString();
+            if (f.isMember("move_precision")) out.field.move_precision = f["move_precision"].asFloat();
+
+            // MoveBatch 는 EventBundle 안에만 실린다 (몰래 켜지 않고 설정 오류로)
+            if (out.field.move_encoding == "compact" && !out.field.bundle_events) {
+                if (err) *err = "field.move_encoding \"compact\" requires field.bundle_events = true";
+                return false;
+            }
+        }
+
+        // placement
+        if (root.isMember("placement")) {
+            auto p = root["placement"];
+            if (p.isMember("io_cores")) out.placement.io_cores = p["io_cores"].asString();
+            if (p.isMember("game_cores")) out.placement.game_cores = p["game_cores"].asString();
+            if (p.isMember("field_cores")) out.placement.field_cores = p["field_cores"].asString();
+            if (p.isMember("storage_cores")) out.placement.storage_cores = p["storage_cores"].asString();
+        }
+
         return true;
     }
 
@@ -25,13 +25,62 @@ namespace config {
         std::size_t max_batch_uids = 2000;
     };
 
+    struct NetConfig {
+        int io_threads = 1;        // 세션 I/O 이벤트 루프 수 (루프당 스레드 1개)
+        int listen_backlog = 128;
+        std::size_t max_write_bytes = 64 * 1024;   // uv_write 한 번에 모을 최대 바이트
+        std::size_t send_high_water_bytes = 256 * 1024;        // 넘으면 Move/Stat 갱신을 최신 것으로 합침
+        std::size_t send_hard_limit_bytes = 4 * 1024 * 1024;   // 넘으면 세션 끊음
+    };
+
+    struct LogConfig {
+        std::string file = "server.log";   // 비우면 파일 출력 안 함
+        std::string level = "info";        // trace / debug / info / warn / error
+        bool console = true;
+    };
+
+    // 고정 스텝 틱 정책 (FieldWorker 틱: Worker::set_tick_policy)
+    struct TickConfig {
+        std::string policy = "catch_up";   // catch_up: 밀린 틱을 바로 이어서 실행 / skip: 밀린 마감은 버림
+        int max_catch_up = 5;              // catch_up 이어도 이보다 많이 밀리면 버린다
+        int spin_margin_us = 1000;         // 마감 전 이 구간은 sleep 대신 spin
+    };
+
+    struct GameConfig {
+        int worker_shards = 1;   // 로그인/입장 등 Game 라우트 패킷을 처리할 GameWorker 수 (세션 ID 로 분배)
+    };
+
+    struct FieldConfig {
+        int scheduler_threads = 0;   // FieldWorker 들을 돌릴 풀 스레드 수 (0 = 코어 수)
+        bool bundle_events = false;  // 틱 동안 watcher 별 이벤트를 EventBundle 한 프레임으로 (클라 지원 필요)
+        std::string move_replication = "position";   // position: 스텝마다 위치 / velocity: 방향·속도 바뀔 때만 (클라 외삽)
+        int move_correction_ms = 1000;               // velocity 모드에서 움직이는 동안 위치 보정 주기
+        std::string move_encoding = "fieldcmd";      // fieldcmd: FieldCmd(Vec2 float) / compact: MoveBatch(섹터 원점 + 16비트 오프셋, bundle_events 필수, 속도 25.5 m/s 까지)
+        float move_precision = 0.01f;                // compact 위치 단위 (m). 섹터/65535 보다 작게는 안 된다
+    };
+
+    // 역할별 CPU 고정 ("0-3,8" 형식, 빈 문자열 = 고정 안 함)
+    //  - 필드 코어는 NUMA 노드 하나 안에 두는 것이 좋다 (필드 메모리는 필드 스레드가 처음 만진 노드에 잡힌다)
+    struct PlacementConfig {
+        std::string io_cores;
+        std::string game_cores;
+        std::string field_cores;
+        std::string storage_cores;
+    };
+
     struct ServerConfig {
         RedisConfig redis;
         MySqlConfig mysql;
         StorageConfig storage;
+        NetConfig net;
+        LogConfig log;
+        TickConfig tick;
+        GameConfig game;
+        FieldConfig field;
+        PlacementConfig placement;
     };
 
-    // Ͽ ε (jsoncpp)
+    // 파일에서 로드 (jsoncpp)
     bool LoadServerConfig(const std::string& path, ServerConfig& out, std::string* err = nullptr);
 
 } // namespace config
@@ -0,0 +1,196 @@
+#include "affinity.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#include "core/log.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace core {
+
+    namespace {
+
+        // "0-3,8" -> {0,1,2,3,8}
+        std::vector<int> parse_cpu_list(const std::string& spec) {
+            std::set<int> out;
+            std::stringstream ss(spec);
+            std::string part;
+
+            while (std::getline(ss, part, ',')) {
+                part.erase(std::remove_if(part.begin(), part.end(), ::isspace), part.end());
+                if (part.empty()) continue;
+
+                const auto dash = part.find('-');
+                const int lo = std::atoi(part.substr(0, dash).c_str());
+                const int hi = dash == std::string::npos ? lo : std::atoi(part.substr(dash + 1).c_str());
+                for (int c = lo; c <= hi && c >= 0; ++c) out.insert(c);
+            }
+            return std::vector<int>(out.begin(), out.end());
+        }
+
+#if defined(__linux__)
+        // /sys/devices/system/node/nodeN/cpulist
+        std::vector<std::vector<int>> linux_numa_nodes() {
+            std::vector<std::vector<int>> nodes;
+            for (int n = 0; n < 1024; ++n) {
+                std::ifstream ifs("/sys/devices/system/node/node" + std::to_string(n) + "/cpulist");
+                if (!ifs.is_open()) break;
+                std::string line;
+                std::getline(ifs, line);
+                nodes.push_back(parse_cpu_list(line));
+            }
+            return nodes;
+        }
+#endif
+
+    } // namespace
+
+    CoreSet CoreSet::Parse(const std::string& spec) {
+        CoreSet cs;
+        cs.cpus = parse_cpu_list(spec);
+        return cs;
+    }
+
+    std::string CoreSet::to_string() const {
+        if (cpus.empty()) return "any";
+
+        std::string out;
+        for (std::size_t i = 0; i < cpus.size();) {
+            std::size_t j = i;
+            while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+
+            if (!out.empty()) out += ",";
+            out += std::to_string(cpus[i]);
+            if (j > i) out += "-" + std::to_string(cpus[j]);
+            i = j + 1;
+        }
+        return out;
+    }
+
+    CoreSet CoreSet::pick(int i, int threads) const {
+        if (cpus.empty() || threads > static_cast<int>(cpus.size())) return *this;
+
+        CoreSet one;
+        one.cpus.push_back(cpus[static_cast<std::size_t>(i) % cpus.size()]);
+        return one;
+    }
+
+    bool PinThread(std::thread::native_handle_type h, const CoreSet& cores) {
+        if (cores.empty()) return false;
+
+#if defined(_WIN32)
+        DWORD_PTR mask = 0;
+        for (int c : cores.cpus) {
+            if (c < static_cast<int>(sizeof(DWORD_PTR) * 8)) mask |= (DWORD_PTR(1) << c);
+        }
+        if (!mask) return false;
+        return SetThreadAffinityMask(static_cast<HANDLE>(h), mask) != 0;
+#elif defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int c : cores.cpus) {
+            if (c < CPU_SETSIZE) CPU_SET(c, &set);
+        }
+        return pthread_setaffinity_np(h, sizeof(set), &set) == 0;
+#else
+        (void)h;
+        return false;
+#endif
+    }
+
+    bool PinCurrentThread(const CoreSet& cores) {
+#if defined(_WIN32)
+        return PinThread(GetCurrentThread(), cores);
+#elif defined(__linux__)
+        return PinThread(pthread_self(), cores);
+#else
+        (void)cores;
+        return false;
+#endif
+    }
+
+    int NumaNodeCount() {
+#if defined(_WIN32)
+        ULONG highest = 0;
+        if (!GetNumaHighestNodeNumber(&highest)) return 1;
+        return static_cast<int>(highest) + 1;
+#elif defined(__linux__)
+        return std::max<int>(1, static_cast<int>(linux_numa_nodes().size()));
+#else
+        return 1;
+#endif
+    }
+
+    int NumaNodeOfCpu(int cpu) {
+#if defined(_WIN32)
+        PROCESSOR_NUMBER pn{};
+        pn.Group = static_cast<WORD>(cpu / 64);
+        pn.Number = static_cast<BYTE>(cpu % 64);
+        USHORT node = 0;
+        if (!GetNumaProcessorNodeEx(&pn, &node) || node == 0xFFFF) return 0;
+        return static_cast<int>(node);
+#elif defined(__linux__)
+        const auto nodes = linux_numa_nodes();
+        for (std::size_t n = 0; n < nodes.size(); ++n) {
+            if (std::find(nodes[n].begin(), nodes[n].end(), cpu) != nodes[n].end())
+                return static_cast<int>(n);
+        }
+        return 0;
+#else
+        (void)cpu;
+        return 0;
+#endif
+    }
+
+    void LogTopology(const config::PlacementConfig& placement) {
+        const unsigned cpus = std::thread::hardware_concurrency();
+        const int nodes = NumaNodeCount();
+
+        LOG_INFO("[Topology] logical_cpus={} numa_nodes={}", cpus, nodes);
+
+        for (int n = 0; n < nodes; ++n) {
+            CoreSet cs;
+            for (unsigned c = 0; c < cpus; ++c) {
+                if (NumaNodeOfCpu(static_cast<int>(c)) == n) cs.cpus.push_back(static_cast<int>(c));
+            }
+            LOG_INFO("[Topology] node{} cpus={}", n, cs.to_string());
+        }
+
+        auto report = [](const char* role, const std::string& spec) {
+            const CoreSet cs = CoreSet::Parse(spec);
+
+            std::set<int> roleNodes;
+            for (int c : cs.cpus) roleNodes.insert(NumaNodeOfCpu(c));
+
+            std::string nodeList;
+            for (int n : roleNodes) {
+                if (!nodeList.empty()) nodeList += ",";
+                nodeList += std::to_string(n);
+            }
+
+            LOG_INFO("[Topology] {} cpus={} nodes={}", role, cs.to_string(), nodeList.empty() ? "any" : nodeList);
+            if (roleNodes.size() > 1) {
+                LOG_WARN("[Topology] {} spans {} NUMA nodes (cross-node memory access)", role, roleNodes.size());
+            }
+        };
+
+        report("io", placement.io_cores);
+        report("game", placement.game_cores);
+        report("field", placement.field_cores);
+        report("storage", placement.storage_cores);
+    }
+
+} // namespace core
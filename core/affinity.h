@@ -0,0 +1,38 @@
+// core/affinity.h
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config/server_config.h"
+
+namespace core {
+
+    // 논리 CPU 번호 집합. "0-3,8,10-11" 형식으로 설정한다 (빈 문자열 = 고정 안 함)
+    struct CoreSet {
+        std::vector<int> cpus;
+
+        static CoreSet Parse(const std::string& spec);
+
+        bool empty() const { return cpus.empty(); }
+        std::string to_string() const;
+
+        // 스레드 threads 개 중 i 번째가 쓸 집합
+        //  - 스레드 수 <= CPU 수 : CPU 하나씩 (캐시 지역성)
+        //  - 그보다 많으면       : 집합 전체 (OS 가 그 안에서 분산)
+        CoreSet pick(int i, int threads) const;
+    };
+
+    // 실패하거나 지원하지 않는 플랫폼이면 false (고정 없이 계속 돈다)
+    bool PinThread(std::thread::native_handle_type h, const CoreSet& cores);
+    bool PinCurrentThread(const CoreSet& cores);
+
+    // cpu 가 속한 NUMA 노드 (모르면 0)
+    int NumaNodeOfCpu(int cpu);
+    int NumaNodeCount();
+
+    // 시작 시 CPU/NUMA 구성과 역할별 코어 배치를 로그로 남긴다
+    void LogTopology(const config::PlacementConfig& placement);
+
+} // namespace core
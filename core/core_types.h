@@ -20,7 +20,7 @@ static inline float frandRange(uint32_t& s, float a, float b) {
     return a + (b - a) * frand01(s);
 }
 
-// ===== Speed Policy (Player=5 ) =====
+// ===== Speed Policy (Player=5 기준) =====
 constexpr float PLAYER_SPEED = 5.0f;
 
 constexpr float PATROL_SPEED_MUL = 0.50f; // 2.5
@@ -1,32 +1,75 @@
 #include "dispatcher.h"
 
+#include "log.h"
+
 namespace core {
 
-    void Dispatcher::register_handler(game::MsgType type, HandlerFn fn) {
-        handlers_[static_cast<uint8_t>(type)] = std::move(fn);
+    void Dispatcher::register_handler(game::Packet type, HandlerFn fn) {
+        handlers_[static_cast<uint8_t>(type)] = fn;
     }
 
     void Dispatcher::dispatch(const game::Envelope& env, void* session) const {
         if (!env.pkt()) {
-            std::cout << "[Disp] env.pkt() == null" << std::endl;
+            LOG_WARN_RATE(10, "[Disp] env.pkt() == null");
             return;
         }
 
-        auto pktType = env.pkt_type();
-        auto key = static_cast<uint8_t>(pktType);
+        const auto key = static_cast<uint8_t>(env.pkt_type());
 
-        std::cout << "[Disp] pkt_type=" << (int)pktType
-            << " key=" << (int)key << std::endl;
+        LOG_TRACE("[Disp] pkt_type={}", key);
 
-        auto it = handlers_.find(key);
-        if (it == handlers_.end()) {
-            std::cout << "[Disp] NO handler for key=" << (int)key << std::endl;
+        HandlerFn fn = handlers_[key];
+        if (!fn) {
+            LOG_WARN_RATE(10, "[Disp] NO handler for key={}", key);
             return;
         }
 
-        std::cout << "[Disp] call handler for key=" << (int)key << std::endl;
-        it->second(env, session);
+        DispatchCounter& c = thread_counter();
+        c.dispatched.store(c.dispatched.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        fn(env, session);
+    }
+
+    bool Dispatcher::dispatch(const std::uint8_t* data, std::size_t len, void* session) const {
+        flatbuffers::Verifier v(data, len);
+        if (!v.VerifyBuffer<game::Envelope>(nullptr)) {
+            LOG_WARN_RATE(10, "[Disp] verify_envelope FAILED len={}", len);
+            return false;
+        }
+
+        dispatch(*flatbuffers::GetRoot<game::Envelope>(data), session);
+        return true;
+    }
+
+    Dispatcher::DispatchCounter& Dispatcher::thread_counter() const {
+        thread_local const Dispatcher* owner = nullptr;
+        thread_local DispatchCounter*  counter = nullptr;
+        if (owner != this) {
+            std::lock_guard<std::mutex> lock(countersMutex_);
+            counters_.push_back(std::make_unique<DispatchCounter>());
+            counter = counters_.back().get();
+            owner = this;
+        }
+        return *counter;
+    }
+
+    std::uint64_t Dispatcher::dispatched_count() const {
+        std::uint64_t total = 0;
+        std::lock_guard<std::mutex> lock(countersMutex_);
+        for (const auto& c : counters_) total += c->dispatched.load(std::memory_order_relaxed);
+        return total;
     }
 
+    void Dispatcher::log_dispatch_rate() {
+        const auto now = std::chrono::steady_clock::now();
+        const std::uint64_t count = dispatched_count();
+
+        const double sec = std::chrono::duration<double>(now - rateLastTime_).count();
+        const std::uint64_t delta = count - rateLastCount_;
+
+        rateLastTime_ = now;
+        rateLastCount_ = count;
+
+        LOG_INFO("[Disp] dispatched={} pps={}", count, sec > 0.0 ? double(delta) / sec : 0.0);
+    }
 
 } // namespace core
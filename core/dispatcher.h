@@ -1,20 +1,46 @@
 #pragma once
-#include <unordered_map>
-#include <functional>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "Generated/game_generated.h"
 
 namespace core {
 
-    using HandlerFn = std::function<void(const game::Envelope&, void* session)>;
+    // 캡처 없는 함수 포인터 (std::function 간접 호출/할당 없음)
+    using HandlerFn = void(*)(const game::Envelope&, void* session);
 
     class Dispatcher {
     public:
-        void register_handler(game::MsgType type, HandlerFn fn);
+        void register_handler(game::Packet type, HandlerFn fn);
         void dispatch(const game::Envelope& env, void* session) const;
+        // 네트워크에서 받은 그대로의 본문: 여기서 한 번만 verify 후 dispatch
+        bool dispatch(const std::uint8_t* data, std::size_t len, void* session) const;
+
+        // 처리한 패킷 수 (GameWorker pps 측정용). 스레드별 카운터 합
+        std::uint64_t dispatched_count() const;
+
+        // 직전 호출 이후의 dispatch pps 출력 (메인 루프 주기 타이머에서 호출)
+        void log_dispatch_rate();
 
     private:
-        std::unordered_map<uint8_t, HandlerFn> handlers_;
+        // game::Packet 값(uint8) 그대로 인덱스
+        std::array<HandlerFn, 256> handlers_{};
+
+        // 스레드(GameWorker 샤드)별 처리 수: 샤드들이 한 캐시 라인에 fetch_add 하지 않는다
+        struct alignas(64) DispatchCounter {
+            std::atomic<std::uint64_t> dispatched{ 0 };   // 그 스레드만 쓴다
+        };
+        DispatchCounter& thread_counter() const;
+
+        mutable std::mutex                                    countersMutex_;
+        mutable std::vector<std::unique_ptr<DispatchCounter>> counters_;   // 스레드가 끝나도 남겨 둔다 (합계 유지)
+
+        std::uint64_t                         rateLastCount_{ 0 };
+        std::chrono::steady_clock::time_point rateLastTime_{ std::chrono::steady_clock::now() };
     };
 
 } // namespace core
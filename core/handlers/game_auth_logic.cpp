@@ -2,7 +2,6 @@
 #include "game_auth_logic.h"
 
 #include "core/proto/protocol_verify.h"
-#include "core/ids.h"                // core::next_player_id()
 #include "net/session.h"
 #include "net/sessionManager.h"
 #include "game/PlayerManager.h"
@@ -36,11 +35,13 @@ namespace logic {
         }
 
 
+        // 이미 로그인한 세션 (같은 세션 패킷은 한 샤드에서 순서대로 오므로 여기서 걸러진다)
         if (session->player_id() != 0) {
+            return;
         }
 
-
-        const std::uint64_t playerId = core::next_player_id();
+        // 다른 샤드와 동시에 돈다: ID 는 PlayerManager 의 atomic, 등록은 PlayerManager/SessionManager 락
+        const std::uint64_t playerId = pm.allocate_id();
         auto playerSession = session->shared_from_this();
         auto player = pm.create_player(playerId, userId, playerSession);
 
@@ -6,7 +6,7 @@ namespace net { class Session; }
 
 namespace logic {
 
-    // α Ŷ  ڵ鷯
+    // 로그인 패킷 수신 핸들러
     void OnRecv_Login(net::Session* session, const game::Envelope& env);
 
 }
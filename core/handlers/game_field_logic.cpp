@@ -53,10 +53,17 @@ namespace logic {
 
         uint32_t fieldId = req->field_id();
 
-        // 1) Player 기본 세팅
-        player->set_field_id(fieldId);
-        player->set_pos(102.1f, 155.91f);
-        //player->set_prefab_name("Paladin");
+        // 이전 필드로 가던 라우트는 먼저 닫는다 (새 필드 입장을 넣은 뒤 다시 연다)
+        session->clear_field_routes();
+        const int prevField = session->field_id();
+        if (session->state() == net::SessionState::InField && prevField != 0
+            && prevField != static_cast<int>(fieldId)) {
+            core::NetMessage leave;
+            leave.type = core::MessageType::LeaveField;
+            leave.session = session->handle();
+            leave.cmd = core::PlayerRefData{ player->id() };
+            core::SendToFieldWorker(prevField, std::move(leave));
+        }
 
         //  FieldWorker 준비만 해둔다 (아직 add_player 안함)
         auto& fm = core::FieldManager::instance();
@@ -66,7 +73,8 @@ namespace logic {
         auto fw = std::dynamic_pointer_cast<core::FieldWorker>(fwBase);
         if (!fw) return;
 
-        // 3세션 상태를 필드로 전환
+        // 3세션 상태를 필드로 전환 (I/O 루프가 보는 필드 워커 포인터도 같이)
+        session->set_field_worker(fw.get());
         session->set_field_id(static_cast<int>(fieldId));
         session->set_state(net::SessionState::InField);
 
@@ -95,9 +103,19 @@ namespace logic {
         }
 
         //이제야 FieldWorker 에 플레이어 등록
-        // 여기서 AOI Snapshot / Enter 이벤트가 발생하고
+        // 필드 상태는 필드 워커 스레드만 만지므로 메시지로 넘긴다.
+        // 워커가 처리하면서 AOI Snapshot / Enter 이벤트가 발생하고
         // FieldCmd(Enter/Move)들이 클라로 날아감.
-        fw->add_player(player);
+        core::NetMessage msg;
+        msg.type = core::MessageType::EnterField;
+        msg.session = session->handle();
+        // Player 필드/시작 좌표는 필드 워커가 입장 처리하면서 쓴다
+        msg.cmd = core::EnterFieldData{ player->id(), fieldId, 102.1f, 155.91f };
+        fw->push(std::move(msg));
+
+        // 이후 필드 안 게임플레이 패킷은 I/O 스레드가 필드 워커로 바로 보낸다
+        // (EnterField 를 넣은 뒤에 열어야 필드 워커가 입장보다 스킬을 먼저 보지 않는다)
+        session->set_field_routes(net::Session::RouteBit(game::Packet::Packet_SkillCmd));
     }
 
     void OnRecv_SkillCmd(net::Session* session, const game::Envelope& env)
@@ -117,23 +135,12 @@ namespace logic {
             return;
         }
 
-        // 여기서부터는 "필드 워커에 넘겨서 처리"
+        // 여기서부터는 "필드 워커에 넘겨서 처리" (FlatBuffer 다시 만들지 않고 값만 넘긴다)
         core::NetMessage msg;
         msg.type = core::MessageType::SkillCmd;
-        msg.session = session->shared_from_this();
-
-        flatbuffers::FlatBufferBuilder fbb;
-        auto skillOffset = game::CreateSkillCmd(
-            fbb,
-            sk->skill(),
-            sk->targetId()
-        );
-        fbb.Finish(skillOffset);
-
-        msg.payload.assign(
-            fbb.GetBufferPointer(),
-            fbb.GetBufferPointer() + fbb.GetSize()
-        );
+        msg.session = session->handle();
+        msg.cmd = core::SkillCmdData{ static_cast<std::int8_t>(sk->skill()), sk->targetId(),
+            core::Worker::current_enqueued_at() };
 
         core::SendToFieldWorker(fieldId, std::move(msg));
     }
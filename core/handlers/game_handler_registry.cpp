@@ -1,10 +1,10 @@
 #include "game_handler_registry.h"
 
 #include <vector>
-#include <functional>
 
-#include "proto/generated/game_generated.h"   // game::Envelope, game::MsgType
+#include "proto/generated/game_generated.h"   // game::Envelope, game::Packet
 #include "net/session.h"
+#include "core/log.h"
 
 #include "game_system_logic.h"
 #include "game_auth_logic.h"
@@ -12,11 +12,9 @@
 
 namespace {
 
-    using HandlerFunc = std::function<void(const game::Envelope&, void*)>;
-
     struct HandlerEntry {
-        game::MsgType type;
-        HandlerFunc   func;
+        game::Packet    type;
+        core::HandlerFn func;
     };
 
     inline net::Session* ToSession(void* ctx) {
@@ -27,31 +25,31 @@ namespace {
     {
         static std::vector<HandlerEntry> list = {
 
-            // ----- ý  -----
+            // ----- 시스템 관련 -----
             {
-                game::MsgType_Ping,
+                game::Packet_Ping,
                 [](const game::Envelope& env, void* ctx) {
                     logic::OnRecv_Ping(ToSession(ctx), env);
                 }
             },
 
-            // -----  / α -----
+            // ----- 인증 / 로그인 -----
             {
-                game::MsgType_Login,  
+                game::Packet_Login,  
                 [](const game::Envelope& env, void* ctx) {
                     logic::OnRecv_Login(ToSession(ctx), env);
                 }
             },
 
-            // ----- ʵ  -----
+            // ----- 필드 관련 -----
             {
-                game::MsgType_EnterField,  
+                game::Packet_EnterField,  
                 [](const game::Envelope& env, void* ctx) {
                     logic::OnRecv_EnterField(ToSession(ctx), env);
                 }
             },
             {
-                game::MsgType_SkillCmd,
+                game::Packet_SkillCmd,
                 [](const game::Envelope& env, void* ctx) {
                     logic::OnRecv_SkillCmd(ToSession(ctx), env);
                 }
@@ -73,9 +71,7 @@ namespace handlers {
         const auto& table = GetHandlerRegistry();
 
         for (const auto& entry : table) {
-            auto key = static_cast<uint8_t>(entry.type);
-            std::cout << "[Reg] type=" << (int)entry.type
-                << " key=" << (int)key << std::endl;
+            LOG_DEBUG("[Reg] type={}", static_cast<uint8_t>(entry.type));
             disp.register_handler(entry.type, entry.func);
         }
     }
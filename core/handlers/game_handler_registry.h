@@ -4,7 +4,7 @@
 
 namespace handlers {
 
-    //   Ŷ ڵ鷯 Dispatcher 
+    // 모든 게임 패킷 핸들러를 Dispatcher에 등록
     void RegisterAllGameHandlers(core::Dispatcher& disp);
 
 }
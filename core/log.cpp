@@ -0,0 +1,321 @@
+#include "log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+
+namespace core {
+
+    // 스레드 종료 시 링 반납 (writer 가 돌면 retired 표시 후 writer 가 비우고 해제, 아니면 바로 해제)
+    struct Logger::RingHolder {
+        logdetail::LogRing* ring{ nullptr };
+        ~RingHolder() {
+            if (ring) Logger::instance().retire_ring(ring);
+        }
+    };
+
+    namespace {
+
+        constexpr char kLevelChar[] = { 'T', 'D', 'I', 'W', 'E' };
+
+        void append_time(std::string& out, std::int64_t ts_ns) {
+            const std::time_t sec = static_cast<std::time_t>(ts_ns / 1000000000);
+            const int ms = static_cast<int>((ts_ns / 1000000) % 1000);
+
+            std::tm tm{};
+#if defined(_WIN32)
+            localtime_s(&tm, &sec);
+#else
+            localtime_r(&sec, &tm);
+#endif
+            char buf[32];
+            const int n = std::snprintf(buf, sizeof(buf), "%02d:%02d:%02d.%03d",
+                tm.tm_hour, tm.tm_min, tm.tm_sec, ms);
+            out.append(buf, n > 0 ? static_cast<std::size_t>(n) : 0);
+        }
+
+        void append_arg(std::string& out, const logdetail::Record& r, const logdetail::Arg& a) {
+            char buf[32];
+            int n = 0;
+
+            switch (a.type) {
+            case logdetail::ArgType::I64: n = std::snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(a.i)); break;
+            case logdetail::ArgType::U64: n = std::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(a.u)); break;
+            case logdetail::ArgType::F64: n = std::snprintf(buf, sizeof(buf), "%.6g", a.d); break;
+            case logdetail::ArgType::Ptr: n = std::snprintf(buf, sizeof(buf), "0x%llx", static_cast<unsigned long long>(a.u)); break;
+            case logdetail::ArgType::Bool: out.append(a.u ? "true" : "false"); return;
+            case logdetail::ArgType::Str: out.append(r.str + a.soff, a.slen); return;
+            }
+            out.append(buf, n > 0 ? static_cast<std::size_t>(n) : 0);
+        }
+
+        // "HH:MM:SS.mmm L [tid] 메시지\n"
+        void format_record(std::string& out, const logdetail::Record& r) {
+            append_time(out, r.ts_ns);
+            out.push_back(' ');
+            out.push_back(kLevelChar[static_cast<int>(r.level) % 5]);
+            out.append(" [");
+            out.append(std::to_string(r.tid));
+            out.append("] ");
+
+            std::size_t next = 0;
+            for (const char* p = r.fmt; p && *p; ++p) {
+                if (p[0] == '{' && p[1] == '}') {
+                    if (next < r.argc) append_arg(out, r, r.args[next++]);
+                    ++p;
+                    continue;
+                }
+                out.push_back(*p);
+            }
+            out.push_back('\n');
+        }
+
+    } // namespace
+
+    LogLevel ParseLogLevel(const std::string& s) {
+        if (s == "trace") return LogLevel::Trace;
+        if (s == "debug") return LogLevel::Debug;
+        if (s == "warn")  return LogLevel::Warn;
+        if (s == "error") return LogLevel::Error;
+        return LogLevel::Info;
+    }
+
+    namespace logdetail {
+
+        std::uint32_t thread_tag() {
+            static std::atomic<std::uint32_t> next{ 1 };
+            thread_local std::uint32_t tag = next.fetch_add(1, std::memory_order_relaxed);
+            return tag;
+        }
+
+    } // namespace logdetail
+
+    Logger& Logger::instance() {
+        static Logger inst;
+        return inst;
+    }
+
+    Logger::~Logger() {
+        stop();
+    }
+
+    bool Logger::start(const std::string& path, LogLevel level, bool console) {
+        if (running_.load()) return true;
+
+        std::FILE* fp = nullptr;
+        if (!path.empty()) {
+#if defined(_WIN32)
+            if (fopen_s(&fp, path.c_str(), "ab") != 0) fp = nullptr;
+#else
+            fp = std::fopen(path.c_str(), "ab");
+#endif
+            if (!fp) {
+                std::cout << "[Log] cannot open log file: " << path << "\n";
+                return false;
+            }
+        }
+
+        path_ = path;
+        console_ = console;
+        file_ = fp;
+        level_.store(level, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex_);
+            writerActive_ = true;
+        }
+        running_.store(true, std::memory_order_release);
+        thread_ = std::thread([this] { run(); });
+        return true;
+    }
+
+    void Logger::stop() {
+        bool expected = true;
+        if (!running_.compare_exchange_strong(expected, false)) return;
+
+        if (thread_.joinable()) thread_.join();
+
+        // writer 가 끝났다: 이미 끝난 스레드의 링은 여기서, 이후 끝나는 스레드의 링은 retire_ring 이 바로 놓는다
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex_);
+            writerActive_ = false;
+            for (std::size_t i = 0; i < rings_.size();) {
+                logdetail::LogRing* ring = rings_[i];
+                if (!ring->retired.load(std::memory_order_acquire)) {
+                    ++i;
+                    continue;
+                }
+                rings_[i] = rings_.back();
+                rings_.pop_back();
+                free_ring_locked(ring);
+            }
+        }
+
+        if (file_) {
+            std::fclose(static_cast<std::FILE*>(file_));
+            file_ = nullptr;
+        }
+    }
+
+    logdetail::LogRing* Logger::local_ring() {
+        thread_local RingHolder holder;
+        if (!holder.ring) holder.ring = register_ring();
+        return holder.ring;
+    }
+
+    logdetail::LogRing* Logger::register_ring() {
+        auto* ring = new logdetail::LogRing();
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings_.push_back(ring);
+        return ring;
+    }
+
+    void Logger::retire_ring(logdetail::LogRing* ring) {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        if (writerActive_) {
+            ring->retired.store(true, std::memory_order_release);
+            return;
+        }
+
+        // writer 가 없다 (stop 뒤): 남은 레코드는 쓸 곳이 없으므로 버리고 해제
+        auto it = std::find(rings_.begin(), rings_.end(), ring);
+        if (it != rings_.end()) {
+            *it = rings_.back();
+            rings_.pop_back();
+        }
+        free_ring_locked(ring);
+    }
+
+    // 통계 누적값에 더하고 해제 (rings_ 에서는 이미 뺐다)
+    void Logger::free_ring_locked(logdetail::LogRing* ring) {
+        retiredDropped_ += ring->dropped.load(std::memory_order_relaxed);
+        retiredSampled_ += ring->sampled.load(std::memory_order_relaxed);
+        retiredSampledNs_ += ring->sampledNs.load(std::memory_order_relaxed);
+        delete ring;
+    }
+
+    void Logger::run() {
+        std::string out;
+        out.reserve(64 * 1024);
+
+        while (running_.load(std::memory_order_acquire)) {
+            const std::size_t n = drain_once(out);
+            flush_out(out);
+
+            if (n == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        // 종료 직전까지 쌓인 것 마저 쓴다
+        while (drain_once(out) > 0) {
+            flush_out(out);
+        }
+        flush_out(out);
+    }
+
+    // 모든 링을 한 바퀴 돌며 쌓인 레코드를 out 에 포맷한다
+    //  - 락은 링 목록 복사/정리 때만 (포맷 중에는 새 스레드 등록/stats 를 막지 않는다)
+    //  - 링은 writer 만 해제하므로 복사한 목록은 락 밖에서도 유효하다
+    std::size_t Logger::drain_once(std::string& out) {
+        std::size_t total = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex_);
+            drainRings_.assign(rings_.begin(), rings_.end());
+        }
+
+        for (logdetail::LogRing* ring : drainRings_) {
+            // retired 를 먼저 본다: 그 뒤 읽은 head 까지가 그 스레드의 마지막 레코드
+            const bool retired = ring->retired.load(std::memory_order_acquire);
+            const std::uint64_t head = ring->head.load(std::memory_order_acquire);
+            std::uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+
+            for (; tail != head; ++tail) {
+                format_record(out, ring->slots[tail & logdetail::LogRing::kMask]);
+                ++total;
+            }
+            ring->tail.store(tail, std::memory_order_release);
+
+            if (retired) drainRetired_.push_back(ring);
+        }
+
+        if (!drainRetired_.empty()) {
+            std::lock_guard<std::mutex> lock(ringsMutex_);
+            for (logdetail::LogRing* ring : drainRetired_) {
+                auto it = std::find(rings_.begin(), rings_.end(), ring);
+                if (it != rings_.end()) {
+                    *it = rings_.back();
+                    rings_.pop_back();
+                }
+                free_ring_locked(ring);
+            }
+            drainRetired_.clear();
+        }
+
+        written_.fetch_add(total, std::memory_order_relaxed);
+        return total;
+    }
+
+    void Logger::flush_out(std::string& out) {
+        if (out.empty()) return;
+
+        if (file_) {
+            auto* fp = static_cast<std::FILE*>(file_);
+            std::fwrite(out.data(), 1, out.size(), fp);
+            std::fflush(fp);
+        }
+        if (console_) {
+            std::fwrite(out.data(), 1, out.size(), stdout);
+            std::fflush(stdout);
+        }
+        out.clear();
+    }
+
+    void Logger::write_sync(const logdetail::Record& rec) {
+        std::string line;
+        format_record(line, rec);
+        std::cout << line;
+    }
+
+    Logger::Stats Logger::stats() const {
+        Stats st;
+        st.written = written_.load(std::memory_order_relaxed);
+
+        std::uint64_t sampled = 0;
+        std::uint64_t sampledNs = 0;
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex_);
+            st.dropped = retiredDropped_;
+            sampled = retiredSampled_;
+            sampledNs = retiredSampledNs_;
+
+            for (const auto* ring : rings_) {
+                st.dropped += ring->dropped.load(std::memory_order_relaxed);
+                sampled += ring->sampled.load(std::memory_order_relaxed);
+                sampledNs += ring->sampledNs.load(std::memory_order_relaxed);
+            }
+            st.rings = rings_.size();
+        }
+
+        st.avg_call_ns = sampled ? sampledNs / sampled : 0;
+        return st;
+    }
+
+    void Logger::log_stats() {
+        const Stats st = stats();
+        const auto now = std::chrono::steady_clock::now();
+
+        const double sec = std::chrono::duration<double>(now - statsLastTime_).count();
+        const std::uint64_t delta = st.written - statsLastWritten_;
+
+        statsLastTime_ = now;
+        statsLastWritten_ = st.written;
+
+        write(LogLevel::Info, "[Log] written={} dropped={} avg_call_ns={} threads={} lines/s={}",
+            st.written, st.dropped, st.avg_call_ns, st.rings,
+            sec > 0.0 ? double(delta) / sec : 0.0);
+    }
+
+} // namespace core
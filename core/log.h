@@ -0,0 +1,324 @@
+// core/log.h
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// 컴파일 타임 최소 레벨 (0=Trace 1=Debug 2=Info 3=Warn 4=Error)
+//  - 이보다 낮은 LOG_xxx 호출은 인자 평가까지 통째로 빠진다
+#ifndef CORE_LOG_MIN_LEVEL
+#define CORE_LOG_MIN_LEVEL 1
+#endif
+
+namespace core {
+
+    enum class LogLevel : std::uint8_t {
+        Trace = 0,
+        Debug = 1,
+        Info = 2,
+        Warn = 3,
+        Error = 4,
+    };
+
+    // "trace" / "debug" / "info" / "warn" / "error" (모르는 값은 Info)
+    LogLevel ParseLogLevel(const std::string& s);
+
+    namespace logdetail {
+
+        enum class ArgType : std::uint8_t { I64, U64, F64, Bool, Str, Ptr };
+
+        struct Arg {
+            ArgType       type{ ArgType::I64 };
+            std::uint16_t soff{ 0 };   // Str : Record::str 안의 위치
+            std::uint16_t slen{ 0 };
+            union {
+                std::int64_t  i;
+                std::uint64_t u;
+                double        d;
+            };
+        };
+
+        inline constexpr std::size_t kMaxArgs = 8;
+        inline constexpr std::size_t kInlineStr = 112;
+
+        // 링에 그대로 들어가는 바이너리 레코드 (포맷은 writer 스레드가 한다)
+        //  - fmt 는 문자열 리터럴이어야 한다 (포인터만 저장)
+        //  - 문자열 인자는 str 에 복사, 넘치면 잘린다
+        struct Record {
+            std::int64_t  ts_ns{ 0 };     // system_clock
+            const char*   fmt{ nullptr };
+            std::uint32_t tid{ 0 };
+            LogLevel      level{ LogLevel::Info };
+            std::uint8_t  argc{ 0 };
+            std::uint16_t strUsed{ 0 };
+            Arg           args[kMaxArgs];
+            char          str[kInlineStr];
+        };
+
+        // 스레드 하나가 쓰고 writer 스레드 하나가 읽는 SPSC 링
+        struct LogRing {
+            static constexpr std::size_t kCapacity = 1024;   // 2의 거듭제곱
+            static constexpr std::size_t kMask = kCapacity - 1;
+
+            Record slots[kCapacity];
+
+            alignas(64) std::atomic<std::uint64_t> head{ 0 };   // producer
+            alignas(64) std::atomic<std::uint64_t> tail{ 0 };   // consumer
+
+            // producer 만 쓰는 값 (통계는 다른 스레드에서 relaxed 로 읽는다)
+            alignas(64) std::uint64_t              calls{ 0 };
+            std::atomic<std::uint64_t>             dropped{ 0 };
+            std::atomic<std::uint64_t>             sampled{ 0 };
+            std::atomic<std::uint64_t>             sampledNs{ 0 };
+
+            std::atomic<bool>                      retired{ false };   // 스레드 종료
+
+            Record* try_claim() {
+                const std::uint64_t h = head.load(std::memory_order_relaxed);
+                if (h - tail.load(std::memory_order_acquire) >= kCapacity) return nullptr;
+                return &slots[h & kMask];
+            }
+            void commit() {
+                head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+        };
+
+        std::uint32_t thread_tag();
+
+        inline void put_str(Record& r, Arg& a, std::string_view s) {
+            const std::size_t room = kInlineStr - r.strUsed;
+            const std::size_t n = s.size() < room ? s.size() : room;
+            std::memcpy(r.str + r.strUsed, s.data(), n);
+            a.type = ArgType::Str;
+            a.soff = r.strUsed;
+            a.slen = static_cast<std::uint16_t>(n);
+            r.strUsed = static_cast<std::uint16_t>(r.strUsed + n);
+        }
+
+        template <class T>
+        inline void put_arg(Record& r, const T& v) {
+            using D = std::decay_t<T>;
+            Arg& a = r.args[r.argc++];
+
+            if constexpr (std::is_same_v<D, bool>) {
+                a.type = ArgType::Bool;
+                a.u = v ? 1 : 0;
+            }
+            else if constexpr (std::is_enum_v<D>) {
+                a.type = ArgType::I64;
+                a.i = static_cast<std::int64_t>(v);
+            }
+            else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) {
+                a.type = ArgType::I64;
+                a.i = static_cast<std::int64_t>(v);
+            }
+            else if constexpr (std::is_integral_v<D>) {
+                a.type = ArgType::U64;
+                a.u = static_cast<std::uint64_t>(v);
+            }
+            else if constexpr (std::is_floating_point_v<D>) {
+                a.type = ArgType::F64;
+                a.d = static_cast<double>(v);
+            }
+            else if constexpr (std::is_pointer_v<T> && (std::is_same_v<D, const char*> || std::is_same_v<D, char*>)) {
+                put_str(r, a, v ? std::string_view(v) : std::string_view("(null)"));
+            }
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+                put_str(r, a, std::string_view(v));
+            }
+            else if constexpr (std::is_pointer_v<D>) {
+                a.type = ArgType::Ptr;
+                a.u = reinterpret_cast<std::uintptr_t>(v);
+            }
+            else {
+                static_assert(std::is_pointer_v<D>, "unsupported log argument type");
+            }
+        }
+
+        template <class... Args>
+        inline void fill(Record& r, LogLevel lv, const char* fmt, const Args&... args) {
+            r.ts_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            r.fmt = fmt;
+            r.tid = thread_tag();
+            r.level = lv;
+            r.argc = 0;
+            r.strUsed = 0;
+            (put_arg(r, args), ...);
+        }
+
+    } // namespace logdetail
+
+    // 비동기 로거
+    //  - 호출 스레드는 자기 SPSC 링에 바이너리 레코드만 넣고 바로 리턴 (락/포맷/IO 없음)
+    //  - 링이 가득 차면 기다리지 않고 버린다 (dropped 로 집계)
+    //  - writer 스레드 하나가 모든 링을 돌며 "{}" 자리에 인자를 채워 파일(+콘솔)에 쓴다
+    //  - start() 전에는 호출 스레드에서 바로 포맷해서 콘솔에 출력
+    class Logger {
+    public:
+        struct Stats {
+            std::uint64_t written{ 0 };       // writer 가 쓴 레코드 수
+            std::uint64_t dropped{ 0 };       // 링이 가득 차서 버린 수
+            std::uint64_t avg_call_ns{ 0 };   // 샘플링한 LOG 호출 1회 비용
+            std::size_t   rings{ 0 };         // 로그를 쓴 적 있는 살아있는 스레드 수
+        };
+
+        static Logger& instance();
+
+        bool start(const std::string& path, LogLevel level = LogLevel::Info, bool console = true);
+        void stop();
+
+        void set_level(LogLevel lv) { level_.store(lv, std::memory_order_relaxed); }
+        bool enabled(LogLevel lv) const {
+            return lv >= level_.load(std::memory_order_relaxed);
+        }
+
+        template <class... Args>
+        void write(LogLevel lv, const char* fmt, const Args&... args) {
+            static_assert(sizeof...(Args) <= logdetail::kMaxArgs, "too many log arguments");
+
+            if (!running_.load(std::memory_order_acquire)) {
+                logdetail::Record rec;
+                logdetail::fill(rec, lv, fmt, args...);
+                write_sync(rec);
+                return;
+            }
+
+            logdetail::LogRing* ring = local_ring();
+
+            // 64번에 한 번만 호출 비용을 잰다
+            const bool sample = (ring->calls++ & 63) == 0;
+            std::chrono::steady_clock::time_point t0;
+            if (sample) t0 = std::chrono::steady_clock::now();
+
+            logdetail::Record* rec = ring->try_claim();
+            if (!rec) {
+                ring->dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            logdetail::fill(*rec, lv, fmt, args...);
+            ring->commit();
+
+            if (sample) {
+                const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - t0).count();
+                ring->sampledNs.fetch_add(static_cast<std::uint64_t>(ns), std::memory_order_relaxed);
+                ring->sampled.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        Stats stats() const;
+
+        // 통계 + 직전 호출 이후 writer 처리량(lines/s)을 로그로 남긴다
+        void log_stats();
+
+    private:
+        Logger() = default;
+        ~Logger();
+
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        struct RingHolder;   // 스레드 종료 시 링 반납 (log.cpp)
+
+        logdetail::LogRing* local_ring();
+        logdetail::LogRing* register_ring();
+        void retire_ring(logdetail::LogRing* ring);
+        void free_ring_locked(logdetail::LogRing* ring);
+
+        void run();
+        std::size_t drain_once(std::string& out);
+        void flush_out(std::string& out);
+        static void write_sync(const logdetail::Record& rec);
+
+    private:
+        std::atomic<LogLevel> level_{ LogLevel::Info };
+        std::atomic<bool>     running_{ false };
+        std::thread           thread_;
+
+        mutable std::mutex                  ringsMutex_;
+        std::vector<logdetail::LogRing*>    rings_;
+        std::uint64_t                       retiredDropped_{ 0 };   // 정리된 링들의 누적값
+        std::uint64_t                       retiredSampled_{ 0 };
+        std::uint64_t                       retiredSampledNs_{ 0 };
+        bool                                writerActive_{ false };   // ringsMutex_ 보호. false 면 retire 가 바로 해제
+        std::vector<logdetail::LogRing*>    drainRings_;     // writer 전용: 락 밖에서 포맷할 링 목록
+        std::vector<logdetail::LogRing*>    drainRetired_;   // writer 전용
+
+        std::atomic<std::uint64_t> written_{ 0 };
+
+        std::string path_;
+        bool        console_{ true };
+        void*       file_{ nullptr };   // std::FILE*
+
+        std::uint64_t                         statsLastWritten_{ 0 };
+        std::chrono::steady_clock::time_point statsLastTime_{ std::chrono::steady_clock::now() };
+    };
+
+    // 호출 위치별 초당 횟수 제한 (LOG_xxx_RATE 매크로가 static 으로 하나씩 만든다)
+    //  - 1초 창 안에서 perSec 개를 넘긴 호출은 버리고, 창이 바뀔 때 버린 개수를 한 줄 남긴다
+    class LogSite {
+    public:
+        bool allow(std::uint32_t perSec, const char* file, int line) {
+            const std::int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+
+            std::int64_t w = window_.load(std::memory_order_relaxed);
+            if (now != w && window_.compare_exchange_strong(w, now, std::memory_order_relaxed)) {
+                count_.store(0, std::memory_order_relaxed);
+                const std::uint32_t n = suppressed_.exchange(0, std::memory_order_relaxed);
+                if (n > 0) {
+                    Logger::instance().write(LogLevel::Warn,
+                        "[Log] rate limit dropped {} lines at {}:{}", n, file, line);
+                }
+            }
+
+            if (count_.fetch_add(1, std::memory_order_relaxed) < perSec) return true;
+
+            suppressed_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+    private:
+        std::atomic<std::int64_t>  window_{ 0 };
+        std::atomic<std::uint32_t> count_{ 0 };
+        std::atomic<std::uint32_t> suppressed_{ 0 };
+    };
+
+} // namespace core
+
+#define CORE_LOG(lv, ...)                                                           \
+    do {                                                                            \
+        if constexpr (static_cast<int>(lv) >= CORE_LOG_MIN_LEVEL) {                 \
+            if (::core::Logger::instance().enabled(lv))                             \
+                ::core::Logger::instance().write(lv, __VA_ARGS__);                  \
+        }                                                                           \
+    } while (0)
+
+#define CORE_LOG_RATE(lv, perSec, ...)                                              \
+    do {                                                                            \
+        if constexpr (static_cast<int>(lv) >= CORE_LOG_MIN_LEVEL) {                 \
+            static ::core::LogSite core_log_site_;                                  \
+            if (::core::Logger::instance().enabled(lv) &&                           \
+                core_log_site_.allow((perSec), __FILE__, __LINE__))                 \
+                ::core::Logger::instance().write(lv, __VA_ARGS__);                  \
+        }                                                                           \
+    } while (0)
+
+#define LOG_TRACE(...) CORE_LOG(::core::LogLevel::Trace, __VA_ARGS__)
+#define LOG_DEBUG(...) CORE_LOG(::core::LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...)  CORE_LOG(::core::LogLevel::Info,  __VA_ARGS__)
+#define LOG_WARN(...)  CORE_LOG(::core::LogLevel::Warn,  __VA_ARGS__)
+#define LOG_ERROR(...) CORE_LOG(::core::LogLevel::Error, __VA_ARGS__)
+
+#define LOG_WARN_RATE(perSec, ...)  CORE_LOG_RATE(::core::LogLevel::Warn,  perSec, __VA_ARGS__)
+#define LOG_ERROR_RATE(perSec, ...) CORE_LOG_RATE(::core::LogLevel::Error, perSec, __VA_ARGS__)
@@ -0,0 +1,113 @@
+// core/mpsc_queue.h
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace core {
+
+    // 고정 크기 MPSC 큐 (Vyukov bounded queue, 소비자 1명 전용으로 단순화)
+    //  - 생산자: 칸 번호를 CAS 로 잡고, 값을 넣은 뒤 칸의 seq 를 올려 공개한다 (락 없음)
+    //  - 소비자: 자기 위치의 seq 만 보고 꺼낸다 (CAS 없음)
+    //  - 가득 차면 try_push 가 false (기다릴지 버릴지는 호출자가 정한다)
+    //  - 칸 배열을 생성 때 한 번만 할당하고 재사용한다 (push/pop 마다 할당 없음)
+    template <class T>
+    class MpscQueue {
+    public:
+        // capacity 는 2의 거듭제곱으로 올림
+        explicit MpscQueue(std::size_t capacity) {
+            std::size_t cap = 2;
+            while (cap < capacity) cap <<= 1;
+
+            mask_ = cap - 1;
+            cells_ = std::make_unique<Cell[]>(cap);
+            for (std::size_t i = 0; i < cap; ++i) {
+                cells_[i].seq.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        std::size_t capacity() const { return mask_ + 1; }
+
+        // 여러 스레드에서 호출 가능
+        bool try_push(T&& v) {
+            Cell* cell = nullptr;
+            std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+
+            for (;;) {
+                cell = &cells_[pos & mask_];
+                const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+                const auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+                if (dif == 0) {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (dif < 0) {
+                    return false;   // 가득 참
+                }
+                else {
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = std::move(v);
+            cell->seq.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // 소비자 스레드 전용
+        bool try_pop(T& out) {
+            const std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+            Cell& cell = cells_[pos & mask_];
+
+            const std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1) < 0)
+                return false;   // 비었거나 생산자가 아직 값을 쓰는 중
+
+            out = std::move(cell.value);
+            cell.seq.store(pos + mask_ + 1, std::memory_order_release);
+            dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // 소비자 스레드 전용: 최대 maxCount 개를 fn(T&&) 로 넘긴다. 처리한 개수 반환
+        template <class Fn>
+        std::size_t drain(Fn&& fn, std::size_t maxCount = SIZE_MAX) {
+            std::size_t n = 0;
+            T item;
+            while (n < maxCount && try_pop(item)) {
+                fn(std::move(item));
+                ++n;
+            }
+            return n;
+        }
+
+        // 어느 스레드에서나 읽을 수 있는 근사치 (락 없음)
+        std::size_t size_approx() const {
+            const std::size_t enq = enqueuePos_.load(std::memory_order_relaxed);
+            const std::size_t deq = dequeuePos_.load(std::memory_order_relaxed);
+            return enq > deq ? enq - deq : 0;
+        }
+
+        bool empty_approx() const { return size_approx() == 0; }
+
+    private:
+        struct Cell {
+            std::atomic<std::size_t> seq{ 0 };
+            T                        value{};
+        };
+
+        std::unique_ptr<Cell[]> cells_;
+        std::size_t             mask_{ 0 };
+
+        alignas(64) std::atomic<std::size_t> enqueuePos_{ 0 };
+        alignas(64) std::atomic<std::size_t> dequeuePos_{ 0 };
+    };
+
+} // namespace core
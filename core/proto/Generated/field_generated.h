@@ -30,6 +30,14 @@ struct AiStateEventBuilder;
 struct StatEvent;
 struct StatEventBuilder;
 
+struct PackedMove;
+
+struct MoveBatch;
+struct MoveBatchBuilder;
+
+struct EventBundle;
+struct EventBundleBuilder;
+
 struct Envelope;
 struct EnvelopeBuilder;
 
@@ -147,35 +155,41 @@ enum Packet : uint8_t {
   Packet_CombatEvent = 2,
   Packet_AiStateEvent = 3,
   Packet_StatEvent = 4,
+  Packet_EventBundle = 5,
+  Packet_MoveBatch = 6,
   Packet_MIN = Packet_NONE,
-  Packet_MAX = Packet_StatEvent
+  Packet_MAX = Packet_MoveBatch
 };
 
-inline const Packet (&EnumValuesPacket())[5] {
+inline const Packet (&EnumValuesPacket())[7] {
   static const Packet values[] = {
     Packet_NONE,
     Packet_FieldCmd,
     Packet_CombatEvent,
     Packet_AiStateEvent,
-    Packet_StatEvent
+    Packet_StatEvent,
+    Packet_EventBundle,
+    Packet_MoveBatch
   };
   return values;
 }
 
 inline const char * const *EnumNamesPacket() {
-  static const char * const names[6] = {
+  static const char * const names[8] = {
     "NONE",
     "FieldCmd",
     "CombatEvent",
     "AiStateEvent",
     "StatEvent",
+    "EventBundle",
+    "MoveBatch",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNamePacket(Packet e) {
-  if (::flatbuffers::IsOutRange(e, Packet_NONE, Packet_StatEvent)) return "";
+  if (::flatbuffers::IsOutRange(e, Packet_NONE, Packet_MoveBatch)) return "";
   const size_t index = static_cast<size_t>(e);
   return EnumNamesPacket()[index];
 }
@@ -200,9 +214,79 @@ template<> struct PacketTraits<field::StatEvent> {
   static const Packet enum_value = Packet_StatEvent;
 };
 
+template<> struct PacketTraits<field::EventBundle> {
+  static const Packet enum_value = Packet_EventBundle;
+};
+
+template<> struct PacketTraits<field::MoveBatch> {
+  static const Packet enum_value = Packet_MoveBatch;
+};
+
 bool VerifyPacket(::flatbuffers::Verifier &verifier, const void *obj, Packet type);
 bool VerifyPacketVector(::flatbuffers::Verifier &verifier, const ::flatbuffers::Vector<::flatbuffers::Offset<void>> *values, const ::flatbuffers::Vector<uint8_t> *types);
 
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) PackedMove FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint64_t id_;
+  int16_t sx_;
+  int16_t sy_;
+  uint16_t ox_;
+  uint16_t oy_;
+  uint8_t heading_;
+  uint8_t speed_;
+  int16_t padding0__;  int32_t padding1__;
+
+ public:
+  PackedMove()
+      : id_(0),
+        sx_(0),
+        sy_(0),
+        ox_(0),
+        oy_(0),
+        heading_(0),
+        speed_(0),
+        padding0__(0),
+        padding1__(0) {
+    (void)padding0__;
+    (void)padding1__;
+  }
+  PackedMove(uint64_t _id, int16_t _sx, int16_t _sy, uint16_t _ox, uint16_t _oy, uint8_t _heading, uint8_t _speed)
+      : id_(::flatbuffers::EndianScalar(_id)),
+        sx_(::flatbuffers::EndianScalar(_sx)),
+        sy_(::flatbuffers::EndianScalar(_sy)),
+        ox_(::flatbuffers::EndianScalar(_ox)),
+        oy_(::flatbuffers::EndianScalar(_oy)),
+        heading_(::flatbuffers::EndianScalar(_heading)),
+        speed_(::flatbuffers::EndianScalar(_speed)),
+        padding0__(0),
+        padding1__(0) {
+    (void)padding0__;
+    (void)padding1__;
+  }
+  uint64_t id() const {
+    return ::flatbuffers::EndianScalar(id_);
+  }
+  int16_t sx() const {
+    return ::flatbuffers::EndianScalar(sx_);
+  }
+  int16_t sy() const {
+    return ::flatbuffers::EndianScalar(sy_);
+  }
+  uint16_t ox() const {
+    return ::flatbuffers::EndianScalar(ox_);
+  }
+  uint16_t oy() const {
+    return ::flatbuffers::EndianScalar(oy_);
+  }
+  uint8_t heading() const {
+    return ::flatbuffers::EndianScalar(heading_);
+  }
+  uint8_t speed() const {
+    return ::flatbuffers::EndianScalar(speed_);
+  }
+};
+FLATBUFFERS_STRUCT_END(PackedMove, 24);
+
 struct Vec2 FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef Vec2Builder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
@@ -262,7 +346,8 @@ struct FieldCmd FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_ENTITYID = 8,
     VT_POS = 10,
     VT_DIR = 12,
-    VT_PREFAB = 14
+    VT_PREFAB = 14,
+    VT_SPEED = 16
   };
   field::FieldCmdType type() const {
     return static_cast<field::FieldCmdType>(GetField<int8_t>(VT_TYPE, 0));
@@ -282,6 +367,9 @@ struct FieldCmd FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::String *prefab() const {
     return GetPointer<const ::flatbuffers::String *>(VT_PREFAB);
   }
+  float speed() const {
+    return GetField<float>(VT_SPEED, 0.0f);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_TYPE, 1) &&
@@ -293,6 +381,7 @@ struct FieldCmd FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyTable(dir()) &&
            VerifyOffset(verifier, VT_PREFAB) &&
            verifier.VerifyString(prefab()) &&
+           VerifyField<float>(verifier, VT_SPEED, 4) &&
            verifier.EndTable();
   }
 };
@@ -319,6 +408,9 @@ struct FieldCmdBuilder {
   void add_prefab(::flatbuffers::Offset<::flatbuffers::String> prefab) {
     fbb_.AddOffset(FieldCmd::VT_PREFAB, prefab);
   }
+  void add_speed(float speed) {
+    fbb_.AddElement<float>(FieldCmd::VT_SPEED, speed, 0.0f);
+  }
   explicit FieldCmdBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -337,9 +429,11 @@ inline ::flatbuffers::Offset<FieldCmd> CreateFieldCmd(
     uint64_t entityId = 0,
     ::flatbuffers::Offset<field::Vec2> pos = 0,
     ::flatbuffers::Offset<field::Vec2> dir = 0,
-    ::flatbuffers::Offset<::flatbuffers::String> prefab = 0) {
+    ::flatbuffers::Offset<::flatbuffers::String> prefab = 0,
+    float speed = 0.0f) {
   FieldCmdBuilder builder_(_fbb);
   builder_.add_entityId(entityId);
+  builder_.add_speed(speed);
   builder_.add_prefab(prefab);
   builder_.add_dir(dir);
   builder_.add_pos(pos);
@@ -355,7 +449,8 @@ inline ::flatbuffers::Offset<FieldCmd> CreateFieldCmdDirect(
     uint64_t entityId = 0,
     ::flatbuffers::Offset<field::Vec2> pos = 0,
     ::flatbuffers::Offset<field::Vec2> dir = 0,
-    const char *prefab = nullptr) {
+    const char *prefab = nullptr,
+    float speed = 0.0f) {
   auto prefab__ = prefab ? _fbb.CreateString(prefab) : 0;
   return field::CreateFieldCmd(
       _fbb,
@@ -364,7 +459,8 @@ inline ::flatbuffers::Offset<FieldCmd> CreateFieldCmdDirect(
       entityId,
       pos,
       dir,
-      prefab__);
+      prefab__,
+      speed);
 }
 
 struct CombatEvent FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -610,6 +706,147 @@ inline ::flatbuffers::Offset<StatEvent> CreateStatEvent(
   return builder_.Finish();
 }
 
+struct MoveBatch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MoveBatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SECTORSIZE = 4,
+    VT_UNIT = 6,
+    VT_MOVES = 8
+  };
+  float sectorSize() const {
+    return GetField<float>(VT_SECTORSIZE, 0.0f);
+  }
+  float unit() const {
+    return GetField<float>(VT_UNIT, 0.0f);
+  }
+  const ::flatbuffers::Vector<const field::PackedMove *> *moves() const {
+    return GetPointer<const ::flatbuffers::Vector<const field::PackedMove *> *>(VT_MOVES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<float>(verifier, VT_SECTORSIZE, 4) &&
+           VerifyField<float>(verifier, VT_UNIT, 4) &&
+           VerifyOffset(verifier, VT_MOVES) &&
+           verifier.VerifyVector(moves()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MoveBatchBuilder {
+  typedef MoveBatch Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_sectorSize(float sectorSize) {
+    fbb_.AddElement<float>(MoveBatch::VT_SECTORSIZE, sectorSize, 0.0f);
+  }
+  void add_unit(float unit) {
+    fbb_.AddElement<float>(MoveBatch::VT_UNIT, unit, 0.0f);
+  }
+  void add_moves(::flatbuffers::Offset<::flatbuffers::Vector<const field::PackedMove *>> moves) {
+    fbb_.AddOffset(MoveBatch::VT_MOVES, moves);
+  }
+  explicit MoveBatchBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MoveBatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MoveBatch>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MoveBatch> CreateMoveBatch(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    float sectorSize = 0.0f,
+    float unit = 0.0f,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const field::PackedMove *>> moves = 0) {
+  MoveBatchBuilder builder_(_fbb);
+  builder_.add_moves(moves);
+  builder_.add_unit(unit);
+  builder_.add_sectorSize(sectorSize);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MoveBatch> CreateMoveBatchDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    float sectorSize = 0.0f,
+    float unit = 0.0f,
+    const std::vector<field::PackedMove> *moves = nullptr) {
+  auto moves__ = moves ? _fbb.CreateVectorOfStructs<field::PackedMove>(*moves) : 0;
+  return field::CreateMoveBatch(
+      _fbb,
+      sectorSize,
+      unit,
+      moves__);
+}
+
+struct EventBundle FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef EventBundleBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_EVENTS_TYPE = 4,
+    VT_EVENTS = 6
+  };
+  const ::flatbuffers::Vector<uint8_t> *events_type() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_EVENTS_TYPE);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<void>> *events() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<void>> *>(VT_EVENTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_EVENTS_TYPE) &&
+           verifier.VerifyVector(events_type()) &&
+           VerifyOffset(verifier, VT_EVENTS) &&
+           verifier.VerifyVector(events()) &&
+           VerifyPacketVector(verifier, events(), events_type()) &&
+           verifier.EndTable();
+  }
+};
+
+struct EventBundleBuilder {
+  typedef EventBundle Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_events_type(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> events_type) {
+    fbb_.AddOffset(EventBundle::VT_EVENTS_TYPE, events_type);
+  }
+  void add_events(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<void>>> events) {
+    fbb_.AddOffset(EventBundle::VT_EVENTS, events);
+  }
+  explicit EventBundleBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<EventBundle> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<EventBundle>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<EventBundle> CreateEventBundle(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> events_type = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<void>>> events = 0) {
+  EventBundleBuilder builder_(_fbb);
+  builder_.add_events(events);
+  builder_.add_events_type(events_type);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<EventBundle> CreateEventBundleDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *events_type = nullptr,
+    const std::vector<::flatbuffers::Offset<void>> *events = nullptr) {
+  auto events_type__ = events_type ? _fbb.CreateVector<uint8_t>(*events_type) : 0;
+  auto events__ = events ? _fbb.CreateVector<::flatbuffers::Offset<void>>(*events) : 0;
+  return field::CreateEventBundle(
+      _fbb,
+      events_type__,
+      events__);
+}
+
 struct Envelope FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef EnvelopeBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
@@ -635,6 +872,12 @@ struct Envelope FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const field::StatEvent *pkt_as_StatEvent() const {
     return pkt_type() == field::Packet_StatEvent ? static_cast<const field::StatEvent *>(pkt()) : nullptr;
   }
+  const field::EventBundle *pkt_as_EventBundle() const {
+    return pkt_type() == field::Packet_EventBundle ? static_cast<const field::EventBundle *>(pkt()) : nullptr;
+  }
+  const field::MoveBatch *pkt_as_MoveBatch() const {
+    return pkt_type() == field::Packet_MoveBatch ? static_cast<const field::MoveBatch *>(pkt()) : nullptr;
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint8_t>(verifier, VT_PKT_TYPE, 1) &&
@@ -660,6 +903,14 @@ template<> inline const field::StatEvent *Envelope::pkt_as<field::StatEvent>() c
   return pkt_as_StatEvent();
 }
 
+template<> inline const field::EventBundle *Envelope::pkt_as<field::EventBundle>() const {
+  return pkt_as_EventBundle();
+}
+
+template<> inline const field::MoveBatch *Envelope::pkt_as<field::MoveBatch>() const {
+  return pkt_as_MoveBatch();
+}
+
 struct EnvelopeBuilder {
   typedef Envelope Table;
   ::flatbuffers::FlatBufferBuilder &fbb_;
@@ -712,6 +963,14 @@ inline bool VerifyPacket(::flatbuffers::Verifier &verifier, const void *obj, Pac
       auto ptr = reinterpret_cast<const field::StatEvent *>(obj);
       return verifier.VerifyTable(ptr);
     }
+    case Packet_EventBundle: {
+      auto ptr = reinterpret_cast<const field::EventBundle *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case Packet_MoveBatch: {
+      auto ptr = reinterpret_cast<const field::MoveBatch *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
     default: return true;
   }
 }
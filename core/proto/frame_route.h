@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace proto {
+
+    // ----------------------------------------------------------------------
+    // 클라 -> 서버 프레임의 라우팅 바이트
+    //   [len (Frame::kHeader)][route 1byte][FlatBuffers 본문]
+    //
+    //  - I/O 스레드는 route 만 보고 받을 워커를 고른다 (verify 안 함)
+    //  - FlatBuffers verify 는 본문을 실제로 소비하는 워커에서 딱 1번
+    //  - len 은 route 바이트를 포함한 길이
+    // ----------------------------------------------------------------------
+    enum class Route : std::uint8_t {
+        Game = 1,   // game::Envelope  -> GameWorker (Login/EnterField/SkillCmd ...)
+        Field = 2,   // field::Envelope -> 세션이 들어가 있는 FieldWorker (FieldCmd)
+    };
+
+    // FlatBuffers 루트 테이블의 1바이트 스칼라 필드(union 타입 등)를 verify 없이 읽는다
+    //  - 라우팅 결정용. 오프셋 경계만 확인하고 본문 검증은 받는 워커가 1회 한다
+    //  - 필드가 비어 있으면 0 (FlatBuffers 기본값)
+    inline bool PeekRootByte(const std::uint8_t* buf, std::size_t len, std::uint16_t vtField, std::uint8_t& out)
+    {
+        auto rd16 = [buf](std::size_t at) {
+            return static_cast<std::uint16_t>(buf[at] | (buf[at + 1] << 8));
+        };
+        auto rd32 = [buf](std::size_t at) {
+            return static_cast<std::uint32_t>(buf[at]) | (static_cast<std::uint32_t>(buf[at + 1]) << 8)
+                | (static_cast<std::uint32_t>(buf[at + 2]) << 16) | (static_cast<std::uint32_t>(buf[at + 3]) << 24);
+        };
+
+        if (!buf || len < 8) return false;
+
+        const std::uint32_t table = rd32(0);
+        if (table > len - 4) return false;
+
+        const std::int64_t vtable = static_cast<std::int64_t>(table) - static_cast<std::int32_t>(rd32(table));
+        if (vtable < 0 || static_cast<std::uint64_t>(vtable) + 4 > len) return false;
+
+        const std::uint16_t vtSize = rd16(static_cast<std::size_t>(vtable));
+        if (vtSize < 4 || static_cast<std::uint64_t>(vtable) + vtSize > len) return false;
+
+        out = 0;
+        if (static_cast<std::uint32_t>(vtField) + 2 > vtSize) return true;
+
+        const std::uint16_t fieldOff = rd16(static_cast<std::size_t>(vtable) + vtField);
+        if (fieldOff == 0) return true;
+        if (static_cast<std::uint64_t>(table) + fieldOff >= len) return false;
+
+        out = buf[table + fieldOff];
+        return true;
+    }
+
+    struct FrameRoute {
+        static constexpr std::size_t kSize = 1;
+
+        // payload 를 route / 본문으로 나눈다 (본문이 비어 있으면 false)
+        static bool split(const std::uint8_t* payload, std::size_t len,
+            Route& route, const std::uint8_t*& body, std::size_t& bodyLen)
+        {
+            if (!payload || len <= kSize) return false;
+
+            route = static_cast<Route>(payload[0]);
+            body = payload + kSize;
+            bodyLen = len - kSize;
+            return true;
+        }
+    };
+
+} // namespace proto
@@ -20,7 +20,7 @@ namespace proto {
 } // namespace proto
 
 // ----------------------------------------------------------------------
-// req ʿ 
+// req만 필요할 때
 //   auto [err, req] = VERIFY_FBS_REQ(Login, env);
 // ----------------------------------------------------------------------
 #define VERIFY_FBS_REQ(MSG_NAME, ENV)                                               \
@@ -41,7 +41,7 @@ namespace proto {
 
 
 // ----------------------------------------------------------------------
-// session  Player  ʿ 
+// session → Player까지 같이 필요할 때
 //   auto [err, req, player] = VERIFY_FBS_REQ_BY_USER(EnterField, env, session);
 // ----------------------------------------------------------------------
 #define VERIFY_FBS_REQ_BY_USER(MSG_NAME, ENV, SESSION)                              \
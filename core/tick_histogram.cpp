@@ -0,0 +1,33 @@
+#include "core/tick_histogram.h"
+
+namespace core {
+
+    void TickHistogram::record(std::int64_t us) {
+        if (us < 0) us = 0;
+
+        std::size_t i = 0;
+        while (i < kBoundsUs.size() && us >= kBoundsUs[i]) ++i;
+
+        buckets_[i].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        if (us > max_.load(std::memory_order_relaxed)) {
+            max_.store(us, std::memory_order_relaxed);
+        }
+    }
+
+    std::int64_t TickHistogram::percentile_us(double q) const {
+        const std::uint64_t total = count();
+        if (total == 0) return 0;
+
+        const auto want = static_cast<std::uint64_t>(q * double(total));
+        std::uint64_t acc = 0;
+        for (std::size_t i = 0; i < kBuckets; ++i) {
+            acc += bucket(i);
+            if (acc > want) {
+                return i < kBoundsUs.size() ? kBoundsUs[i] : max_us();
+            }
+        }
+        return max_us();
+    }
+
+} // namespace core
@@ -0,0 +1,32 @@
+#pragma once
+#include <atomic>
+#include <array>
+#include <cstdint>
+
+namespace core {
+
+    // 마이크로초 단위 고정 버킷 히스토그램 (기록은 틱 스레드 1개, 읽기는 아무 스레드)
+    //  - Worker 틱 지연/초과, FieldScheduler 풀 전체 틱 지연, control 레인 대기 등에 쓴다
+    class TickHistogram {
+    public:
+        static constexpr std::array<std::int64_t, 9> kBoundsUs = {
+            100, 250, 500, 1000, 2000, 5000, 10000, 25000, 50000
+        };
+        static constexpr std::size_t kBuckets = kBoundsUs.size() + 1;   // 마지막 = 50ms 이상
+
+        void record(std::int64_t us);
+
+        std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+        std::int64_t  max_us() const { return max_.load(std::memory_order_relaxed); }
+        std::uint64_t bucket(std::size_t i) const { return buckets_[i].load(std::memory_order_relaxed); }
+
+        // q(0~1) 분위가 들어있는 버킷의 상한 (마지막 버킷이면 max)
+        std::int64_t percentile_us(double q) const;
+
+    private:
+        std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{};
+        std::atomic<std::uint64_t> count_{ 0 };
+        std::atomic<std::int64_t>  max_{ 0 };
+    };
+
+} // namespace core
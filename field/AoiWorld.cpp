@@ -24,11 +24,11 @@ void AoiWorld::add_entity(uint64_t id, bool isPlayer, const AoiVec2& pos)
     e.pos = pos;
     e.sector = world_to_sector(pos);
 
-    // ƼƼ 
+    // 엔티티 등록
     entities_[id] = e;
     enter_sector(id, e.sector);
 
-    // ÷̾    
+    // 플레이어인 경우 구독 섹터 계산
     if (isPlayer) {
         rebuild_player_subscriptions(entities_[id]);
     }
@@ -54,7 +54,7 @@ void AoiWorld::remove_entity(std::uint64_t id)
 
     Entity& e = it->second;
 
-    //    ƼƼ  ִ watcher鿡 Leave ˸
+    //  먼저 이 엔티티를 보고 있던 watcher들에게 Leave 알림
     if (sendCb_) {
         AoiEvent ev;
         ev.type = AoiEvent::Type::Leave;
@@ -64,10 +64,10 @@ void AoiWorld::remove_entity(std::uint64_t id)
         broadcast_to_sector_watchers(e.sector, ev, id);
     }
 
-    // Ϳ 
+    // 섹터에서 제거
     leave_sector(id, e.sector);
 
-    // ÷̾  Ϳ watcher 
+    // 플레이어면 구독 섹터에서 watcher 제거
     if (e.isPlayer) {
         for (const auto& sc : e.subscribed) {
             auto sit = sectors_.find(sc);
@@ -81,7 +81,7 @@ void AoiWorld::remove_entity(std::uint64_t id)
     entities_.erase(it);
 }
 
-void AoiWorld::move_entity(std::uint64_t id, const AoiVec2& newPos)
+void AoiWorld::move_entity(std::uint64_t id, const AoiVec2& newPos, bool notifyMove)
 {
     auto it = entities_.find(id);
     if (it == entities_.end()) return;
@@ -107,7 +107,7 @@ void AoiWorld::move_entity(std::uint64_t id, const AoiVec2& newPos)
 
     if (!sendCb_) return;
 
-    // sectorChanged  old/new watcher  Leave/Enter
+    // sectorChanged일 때만 old/new watcher 차집합으로 Leave/Enter
     if (sectorChanged) {
         const Sector* oldS = get_sector(oldSector);
         const Sector* newS = get_sector(e.sector);
@@ -116,7 +116,7 @@ void AoiWorld::move_entity(std::uint64_t id, const AoiVec2& newPos)
         if (oldS) {
             for (auto watcherId : oldS->watchers) {
                 if (newS && newS->watchers.find(watcherId) != newS->watchers.end())
-                    continue; //    
+                    continue; // 여전히 볼 수 있음
                 if (watcherId == id) continue;
 
                 AoiEvent leaveEv;
@@ -131,7 +131,7 @@ void AoiWorld::move_entity(std::uint64_t id, const AoiVec2& newPos)
         if (newS) {
             for (auto watcherId : newS->watchers) {
                 if (oldS && oldS->watchers.find(watcherId) != oldS->watchers.end())
-                    continue; //  
+                    continue; // 예전부터 보고있음
                 if (watcherId == id) continue;
 
                 AoiEvent enterEv;
@@ -143,17 +143,32 @@ void AoiWorld::move_entity(std::uint64_t id, const AoiVec2& newPos)
         }
     }
 
-    //  Move  watcherԸ
-    {
-        AoiEvent ev;
-        ev.type = AoiEvent::Type::Move;
-        ev.subjectId = id;
-        ev.position = e.pos;
+    if (notifyMove) {
+        broadcast_move(e);
+    }
+}
 
-        broadcast_to_sector_watchers(e.sector, ev, id);
-        if (e.isPlayer) {
-            sendCb_(id, ev);
-        }
+void AoiWorld::notify_move(std::uint64_t id)
+{
+    if (!sendCb_) return;
+
+    const Entity* e = get_entity(id);
+    if (!e) return;
+
+    broadcast_move(*e);
+}
+
+//  Move는 현재 섹터watcher에게만
+void AoiWorld::broadcast_move(const Entity& e)
+{
+    AoiEvent ev;
+    ev.type = AoiEvent::Type::Move;
+    ev.subjectId = e.id;
+    ev.position = e.pos;
+
+    broadcast_to_sector_watchers(e.sector, ev, e.id);
+    if (e.isPlayer) {
+        sendCb_(e.id, ev);
     }
 }
 
@@ -244,7 +259,7 @@ void AoiWorld::collect_view_sectors(const Entity& e,
 
 void AoiWorld::rebuild_player_subscriptions(Entity& e)
 {
-    //    
+    //새 구독 섹터 목록 계산
     std::vector<AoiSectorCoord> viewSectors;
     collect_view_sectors(e, viewSectors);
 
@@ -264,12 +279,12 @@ void AoiWorld::rebuild_player_subscriptions(Entity& e)
             toAdd.push_back(newSc);
     }
 
-    //watchers 
+    //watchers 갱신
     for (const auto& sc : toRemove) {
         auto it = sectors_.find(sc);
         if (it == sectors_.end()) continue;
 
-        // watcher   ¥  ̰ Ǵ ƼƼ Leave 
+        // watcher 제거 전에 진짜로 안 보이게 되는 엔티티만 Leave 전송
         if (sendCb_) {
             for (auto otherId : it->second.entities) {
                 if (otherId == e.id) continue;
@@ -277,7 +292,7 @@ void AoiWorld::rebuild_player_subscriptions(Entity& e)
                 const Entity* other = get_entity(otherId);
                 if (!other) continue;
 
-                //  Ͱ  (newSet)    ׼ => Leave 
+                // 현재 섹터가 새 구독(newSet)에 있으면 계속 보임 버그수정 => Leave 금지
                 if (newSet.find(other->sector) != newSet.end())
                     continue;
 
@@ -297,7 +312,7 @@ void AoiWorld::rebuild_player_subscriptions(Entity& e)
         Sector* s = get_or_create_sector(sc);
         s->watchers.insert(e.id);
 
-        //     ƼƼ  Snapshot ̺Ʈ 
+        // 새로 구독한 섹터의 모든 엔티티에 대해 Snapshot 이벤트 전송
         if (sendCb_) {
             for (auto otherId : s->entities) {
                 if (otherId == e.id) continue;
@@ -314,7 +329,7 @@ void AoiWorld::rebuild_player_subscriptions(Entity& e)
         }
     }
 
-    // 4) ÷̾    ֽȭ
+    // 4) 플레이어의 구독 섹터 집합 최신화
     e.subscribed = std::move(newSet);
 }
 
@@ -329,7 +344,7 @@ void AoiWorld::broadcast_to_sector_watchers(const AoiSectorCoord& c,const AoiEve
 
     for (auto watcherId : it->second.watchers) {
         if (excludeId != 0 && watcherId == excludeId)
-            continue; //  
+            continue; // 본인 제외
         sendCb_(watcherId, ev);
     }
 }
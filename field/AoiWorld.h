@@ -31,15 +31,15 @@ struct AoiSectorCoord
     };
 };
 
-// AOI ̺Ʈ Ÿ: Ʈũ Ŷ ϸ 
+// AOI 이벤트 타입: 네트워크 패킷으로 매핑하면 됨
 struct AoiEvent
 {
     enum class Type
     {
-        Enter,      //  ƼƼ  þ߿  
-        Leave,      //  þ߿ 
-        Move,       //  þ ȿ ̵
-        Snapshot    //    ʱ 
+        Enter,      // 어떤 엔티티가 내 시야에 새로 등장
+        Leave,      // 내 시야에서 사라짐
+        Move,       // 내 시야 안에서 이동
+        Snapshot    // 새로 구독한 섹터의 초기 스냅샷
     };
 
     Type          type{};
@@ -63,30 +63,33 @@ public:
         AoiVec2       pos{};
         AoiSectorCoord sector{};
 
-        //     
+        // 내가 구독 중인 섹터 집합
         std::unordered_set<AoiSectorCoord, AoiSectorCoord::Hasher> subscribed;
     };
 
-    //   ĭ
+    // 섹터 한 칸
     struct Sector
     {
-        std::unordered_set<std::uint64_t> entities; //  Ϳ ִ ƼƼ IDs
-        std::unordered_set<std::uint64_t> watchers; //  ͸   ÷̾ IDs
+        std::unordered_set<std::uint64_t> entities; // 이 섹터에 있는 엔티티 IDs
+        std::unordered_set<std::uint64_t> watchers; // 이 섹터를 구독 중인 플레이어 IDs
     };
 
 public:
-    // sectorSize:    (: 5m, 10m)
-    // viewRadiusSectors: AOI ݰ (1̸ 3x3, 2 5x5)
+    // sectorSize: 한 섹터의 길이 (예: 5m, 10m)
+    // viewRadiusSectors: AOI 반경 (1이면 3x3, 2면 5x5)
     explicit AoiWorld(float sectorSize, int viewRadiusSectors);
 
     void set_send_callback(AoiSendCallback cb) { sendCb_ = std::move(cb); }
 
-    // ƼƼ /
+    // 엔티티 등록/삭제
     void add_entity(std::uint64_t id, bool isPlayer, const AoiVec2& pos);
     void remove_entity(std::uint64_t id);
 
 
-    void move_entity(std::uint64_t id, const AoiVec2& newPos);
+    // notifyMove=false: 섹터 이동에 따른 Enter/Leave 만 보내고 Move 는 생략 (속도 복제 모드)
+    void move_entity(std::uint64_t id, const AoiVec2& newPos, bool notifyMove = true);
+    // 현재 위치로 Move 를 시야 watcher 들에게 (플레이어면 본인 포함)
+    void notify_move(std::uint64_t id);
 
 
     void update_player_aoi(std::uint64_t playerId);
@@ -118,5 +121,6 @@ private:
         std::vector<AoiSectorCoord>& out) const;
     void broadcast_to_sector_watchers(const AoiSectorCoord& c,
         const AoiEvent& ev, std::int64_t excludeId = 0);
+    void broadcast_move(const Entity& e);
 };
 static void collect_watchers(const AoiWorld::Sector* s, std::vector<uint64_t>& out);
@@ -1,6 +1,8 @@
 // FieldAoiSystem.cpp
 #include "FieldAoiSystem.h"
 
+#include <algorithm>
+
 namespace core {
 
     FieldAoiSystem::FieldAoiSystem(int fieldId,
@@ -15,7 +17,7 @@ namespace core {
     void FieldAoiSystem::set_send_func(FieldAoiSendFunc func)
     {
         sendFunc_ = std::move(func);
-        setup_aoi_callback();   //   AOI ݹ 
+        setup_aoi_callback();   // 이 시점에서만 AOI 콜백을 물린다
     }
 
     void FieldAoiSystem::setup_aoi_callback()
@@ -23,8 +25,12 @@ namespace core {
         aoi_.set_send_callback(
             [this](std::uint64_t watcherId, const AoiEvent& ev)
             {
-                // watchers_ 
+                // watchers_ 갱신
                 auto& vec = watchers_[ev.subjectId];
+                auto it = std::find_if(vec.begin(), vec.end(),
+                    [watcherId](const WatcherRef& w) { return w.id == watcherId; });
+
+                std::uint32_t slot = kNoWatcherSlot;
 
                 switch (ev.type)
                 {
@@ -32,31 +38,84 @@ namespace core {
                 case AoiEvent::Type::Enter:
                 case AoiEvent::Type::Move:
                 {
-                    // subjectId   ִ watcher Ʈ ߰ (ߺ üũ)
-                    auto it = std::find(vec.begin(), vec.end(), watcherId);
-                    if (it == vec.end())
-                        vec.push_back(watcherId);
+                    // subjectId 를 보고 있는 watcher 리스트에 추가 (중복 체크, 칸은 처음 넣을 때 한 번만 찾는다)
+                    if (it == vec.end()) {
+                        slot = slot_of(watcherId);
+                        vec.push_back(WatcherRef{ watcherId, slot });
+                    }
+                    else {
+                        slot = it->slot;
+                    }
                     break;
                 }
                 case AoiEvent::Type::Leave:
                 {
-                    auto it = std::find(vec.begin(), vec.end(), watcherId);
-                    if (it != vec.end())
+                    if (it != vec.end()) {
+                        slot = it->slot;
                         vec.erase(it);
+                    }
+                    else {
+                        slot = slot_of(watcherId);
+                    }
                     break;
                 }
                 }
 
-                //  ʱȭ ̸ ܺηδ  
+                // 아직 초기화 중이면 외부로는 안 보냄
                 if (!initialized_ || !sendFunc_)
                     return;
 
-                //  ϴ FieldCmd/CombatEvent 
-                sendFunc_(watcherId, ev);
+                emit(watcherId, slot, ev);
             }
         );
     }
 
+    void FieldAoiSystem::emit(std::uint64_t watcherId, std::uint32_t slot, const AoiEvent& ev)
+    {
+        if (!staging_) {
+            // 원래 하던 FieldCmd/CombatEvent 전송
+            sendFunc_(watcherId, slot, ev);
+            return;
+        }
+
+        const PairKey key{ watcherId, ev.subjectId };
+        auto it = lastMove_.find(key);
+
+        if (ev.type != AoiEvent::Type::Move) {
+            // Enter/Leave/Snapshot 은 바로. 그 쌍에 모아 둔 Move 는 버린다
+            if (it != lastMove_.end()) {
+                staged_[it->second].watcherId = 0;
+                lastMove_.erase(it);
+            }
+            sendFunc_(watcherId, slot, ev);
+            return;
+        }
+
+        stagedMoves_.fetch_add(1, std::memory_order_relaxed);
+        if (it != lastMove_.end()) {
+            // 같은 쌍의 앞선 Move 자리에서 위치만 최신으로
+            staged_[it->second].ev.position = ev.position;
+            coalescedMoves_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        lastMove_.emplace(key, staged_.size());
+        staged_.push_back(StagedEvent{ watcherId, slot, ev });
+    }
+
+    void FieldAoiSystem::flush_stage()
+    {
+        // 보내는 중 콜백이 다시 AOI 를 건드려도 바로 보내지도록 스테이징을 먼저 끈다
+        staging_ = false;
+
+        for (const StagedEvent& s : staged_) {
+            if (s.watcherId == 0) continue;
+            sendFunc_(s.watcherId, s.slot, s.ev);
+        }
+
+        staged_.clear();
+        lastMove_.clear();
+    }
+
 
     void FieldAoiSystem::add_entity(std::uint64_t id, bool isPlayer, float x, float y)
     {
@@ -64,26 +123,34 @@ namespace core {
         aoi_.add_entity(id, isPlayer, pos);
     }
 
-    void FieldAoiSystem::move_entity(std::uint64_t id, float x, float y)
+    void FieldAoiSystem::move_entity(std::uint64_t id, float x, float y, bool notifyMove)
     {
         AoiVec2 pos{ x, y };
-        aoi_.move_entity(id, pos);
+        aoi_.move_entity(id, pos, notifyMove);
     }
 
     void FieldAoiSystem::remove_entity(std::uint64_t id)
     {
         aoi_.remove_entity(id);
         watchers_.erase(id);
+        watcherSlot_.erase(id);
+
+        // 틱 중에 빠진 watcher 앞으로 모아 둔 이벤트는 버린다 (이 entity 가 주체인 Leave 는 그대로 나감)
+        if (staging_) {
+            for (StagedEvent& s : staged_) {
+                if (s.watcherId == id) s.watcherId = 0;
+            }
+        }
     }
 
     void FieldAoiSystem::for_each_watcher(
         uint64_t subjectId,
-        std::function<void(uint64_t watcherId)> fn)
+        const std::function<void(uint64_t watcherId, std::uint32_t watcherSlot)>& fn)
     {
         auto it = watchers_.find(subjectId);
         if (it == watchers_.end()) return;
 
-        for (uint64_t watcher : it->second)
-            fn(watcher);
+        for (const WatcherRef& w : it->second)
+            fn(w.id, w.slot);
     }
 } // namespace core
@@ -1,9 +1,12 @@
 // FieldAoiSystem.h
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 #include "worker/worker.h"  
 #include "AoiWorld.h"
@@ -11,36 +14,95 @@
 
 namespace core {
 
-    using FieldAoiSendFunc = std::function<void(std::uint64_t watcherId,
+    // watcherSlot: set_watcher_slot 으로 알려준 필드 로컬 칸 (모르면 kNoWatcherSlot)
+    using FieldAoiSendFunc = std::function<void(std::uint64_t watcherId, std::uint32_t watcherSlot,
         const AoiEvent& ev)>;
 
+    inline constexpr std::uint32_t kNoWatcherSlot = UINT32_MAX;
+
     class FieldAoiSystem
     {
 	 public:
-        using SendFunc = std::function<void(std::uint64_t watcherId,const AoiEvent& ev)>;
+        using SendFunc = FieldAoiSendFunc;
 
         FieldAoiSystem(int fieldId,float sectorSize,int   viewRadiusSectors);
         
         void set_initialized(bool v) { initialized_ = v; }
         void tick_update();
 
-        // 2)  ο   AOI API
+        // 2) 서버 내부에서 직접 쓰는 AOI API
         void add_entity(std::uint64_t id, bool isPlayer, float x, float y);
-        void move_entity(std::uint64_t id, float x, float y);
+        void move_entity(std::uint64_t id, float x, float y, bool notifyMove = true);
+        void notify_move(std::uint64_t id) { aoi_.notify_move(id); }
         void remove_entity(std::uint64_t id);
         using Callback = std::function<void(std::uint64_t watcherId, const AoiEvent& ev)>;
+
+        // 플레이어(watcher)의 필드 로컬 칸 번호. add_entity 전에 알려주면
+        // watcher 목록에 칸을 같이 적어 두어 브로드캐스트 때 조회 없이 바로 쓴다
+        void set_watcher_slot(std::uint64_t id, std::uint32_t slot) { watcherSlot_[id] = slot; }
                 
-        void for_each_watcher(uint64_t subjectId, std::function<void(uint64_t watcherId)> fn);
+        void for_each_watcher(uint64_t subjectId, const std::function<void(uint64_t watcherId, std::uint32_t watcherSlot)>& fn);
         void set_send_func(FieldAoiSendFunc func);
+
+        // 틱 단위 송신 스테이징
+        //  - begin_stage() ~ flush_stage() 사이의 Move 만 바로 보내지 않고 모은다
+        //  - Move 는 (watcher, subject) 당 마지막 위치만 남긴다 (서브스텝/catch-up 으로 한 틱에 여러 번 움직여도 1건)
+        //  - Enter/Leave/Snapshot 은 바로 보낸다 (같은 틱의 AiState/Stat/Combat 보다 Enter 가 먼저 가야 한다)
+        //    그 쌍에 모아 둔 Move 는 버린다 (Leave 뒤 Move 가 가지 않게, Enter/Snapshot 은 위치를 싣는다)
+        //  - 스테이징 밖(메시지 처리 중 입장 등)은 지금처럼 바로 보낸다
+        void begin_stage() { staging_ = true; }
+        void flush_stage();
+        std::uint64_t staged_moves() const { return stagedMoves_.load(std::memory_order_relaxed); }
+        std::uint64_t coalesced_moves() const { return coalescedMoves_.load(std::memory_order_relaxed); }
     private:
+        struct WatcherRef {
+            std::uint64_t id;
+            std::uint32_t slot;
+        };
+
+        struct StagedEvent {
+            std::uint64_t watcherId;   // 0 = 취소됨 (watcher 가 틱 중에 빠짐)
+            std::uint32_t slot;
+            AoiEvent      ev;
+        };
+
+        struct PairKey {
+            std::uint64_t watcherId;
+            std::uint64_t subjectId;
+            bool operator==(const PairKey& o) const {
+                return watcherId == o.watcherId && subjectId == o.subjectId;
+            }
+        };
+        struct PairKeyHash {
+            std::size_t operator()(const PairKey& k) const {
+                std::uint64_t h = k.watcherId * 0x9E3779B97F4A7C15ULL;
+                h ^= k.subjectId + 0x7F4A7C159E3779B9ULL + (h << 6) + (h >> 2);
+                return static_cast<std::size_t>(h);
+            }
+        };
+
+        void emit(std::uint64_t watcherId, std::uint32_t slot, const AoiEvent& ev);
+
+        std::uint32_t slot_of(std::uint64_t id) const {
+            auto it = watcherSlot_.find(id);
+            return it == watcherSlot_.end() ? kNoWatcherSlot : it->second;
+        }
+
         int fieldId_;
         AoiWorld      aoi_;
         FieldAoiSendFunc sendFunc_;
         Callback callback_;
-        std::unordered_map<uint64_t,std::vector<uint64_t>> watchers_;
+        std::unordered_map<uint64_t,std::vector<WatcherRef>> watchers_;
+        std::unordered_map<uint64_t, std::uint32_t> watcherSlot_;
         void setup_aoi_callback();  
 
         bool initialized_ = false;
+
+        bool staging_ = false;
+        std::vector<StagedEvent> staged_;
+        std::unordered_map<PairKey, std::size_t, PairKeyHash> lastMove_;   // (watcher, subject) -> staged_ 인덱스
+        std::atomic<std::uint64_t> stagedMoves_{ 0 };      // 통계 (log_stats 는 다른 스레드)
+        std::atomic<std::uint64_t> coalescedMoves_{ 0 };
      
     };
 
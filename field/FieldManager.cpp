@@ -1,6 +1,7 @@
 #include "field/FieldManager.h"
 #include "worker/FieldWorker.h"          
 #include "storage/StorageSystem.h"      
+#include "core/log.h"
 namespace core {
 
     std::shared_ptr<FieldWorker> FieldManager::create_field(int fieldId)
@@ -15,13 +16,23 @@ namespace core {
         if (!storage_) {
  
 
-            std::cout << "[FieldManager] storage_ is null. Call set_storage() before create_field().\n";
+            LOG_ERROR("[FieldManager] storage_ is null. Call set_storage() before create_field().");
             return nullptr;
         }
 
-        // DirtyHub ۷  
+        if (!scheduler_) {
+            scheduler_ = std::make_unique<FieldScheduler>();
+            scheduler_->start(cfg_.scheduler_threads, cores_);
+        }
+
+        // DirtyHub 레퍼런스 생성자 주입
         auto fw = std::make_shared<FieldWorker>(fieldId, storage_->dirty());
 
+        fw->set_scheduler(scheduler_.get());
+        fw->set_tick_policy(tick_);
+        fw->set_bundle_events(cfg_.bundle_events);
+        fw->set_move_replication(cfg_.move_replication == "velocity", cfg_.move_correction_ms / 1000.0f);
+        fw->set_move_encoding(cfg_.move_encoding == "compact", cfg_.move_precision);
         fw->start();
         fields_[fieldId] = fw;
         return fw;
@@ -43,10 +54,42 @@ namespace core {
         for (auto& [id, w] : fields_) {
             if (w) {
                 w->stop();
+                stoppedFields_.push_back(std::move(w));
             }
         }
         fields_.clear();
+
+        if (scheduler_) {
+            scheduler_->stop();
+            stoppedSchedulers_.push_back(std::move(scheduler_));
+        }
     }
+    void FieldManager::log_stats()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [id, w] : fields_) {
+            if (w) {
+                w->log_stats();
+            }
+        }
+        if (scheduler_) {
+            scheduler_->log_stats();
+        }
+    }
+
+    void FieldManager::configure(const config::FieldConfig& cfg, const CoreSet& cores)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cfg_ = cfg;
+        cores_ = cores;
+    }
+
+    void FieldManager::set_tick_policy(const config::TickConfig& tick)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tick_ = tick;
+    }
+
     void FieldManager::set_storage(storage::StorageSystem* ss)
     {
         std::lock_guard<std::mutex> lock(mutex_);
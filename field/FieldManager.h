@@ -3,8 +3,11 @@
 #include <memory>
 #include <unordered_map>
 #include <mutex>
+#include <vector>
 
 #include "worker/FieldWorker.h" 
+#include "field/FieldScheduler.h"
+#include "config/server_config.h"
 namespace storage { class StorageSystem; class DirtyHub; }
 
 namespace core {
@@ -17,10 +20,17 @@ namespace core {
             return inst;
         }
         void set_storage(storage::StorageSystem* ss);
+        // create_field() 전에 호출 (스케줄러 스레드 수, 필드 풀 스레드를 고정할 코어)
+        void configure(const config::FieldConfig& cfg, const CoreSet& cores = {});
+        // create_field() 전에 호출 (필드 틱 catch_up/skip 정책, spin 구간)
+        void set_tick_policy(const config::TickConfig& tick);
         std::shared_ptr<FieldWorker> create_field(int fieldId);
         std::shared_ptr<FieldWorker> get_field(int fieldId);
         void stop_all();        
 
+        // 필드별 메일박스/스킬 지연 + 스케줄러 통계
+        void log_stats();
+
         template <typename Fn>
         void for_each_field(Fn&& fn)
         {
@@ -41,7 +51,15 @@ namespace core {
 
     private:
         std::mutex mutex_;
+        config::FieldConfig cfg_;
+        config::TickConfig tick_;
+        CoreSet cores_;
+        // 필드들이 공유하는 스레드 풀 (필드마다 스레드를 만들지 않는다). fields_ 보다 먼저 선언: 나중에 파괴
+        std::unique_ptr<FieldScheduler> scheduler_;
         std::unordered_map<int, std::shared_ptr<FieldWorker>> fields_;
+        // stop_all 뒤에도 FieldManager 가 끝날 때까지 둔다 (세션 라우트 테이블이 필드 워커 raw 포인터를 들고 있다)
+        std::vector<std::unique_ptr<FieldScheduler>>  stoppedSchedulers_;
+        std::vector<std::shared_ptr<FieldWorker>>     stoppedFields_;
         storage::StorageSystem* storage_{ nullptr };
     };
 
@@ -0,0 +1,254 @@
+// FieldScheduler.cpp
+#include "FieldScheduler.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "worker/worker.h"
+#include "core/log.h"
+#include "net/session_epoch.h"
+
+namespace core {
+
+    FieldScheduler::~FieldScheduler() {
+        stop();
+    }
+
+    void FieldScheduler::start(int threads, const CoreSet& cores) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (running_) return;
+            running_ = true;
+        }
+
+        if (threads <= 0) {
+            threads = cores.empty()
+                ? static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))
+                : static_cast<int>(cores.cpus.size());
+        }
+        cores_ = cores;
+
+        for (int i = 0; i < threads; ++i) {
+            stats_.push_back(std::make_unique<ThreadStats>());
+        }
+        statsLastBusy_.assign(threads, 0);
+        statsLastSpin_.assign(threads, 0);
+
+        for (int i = 0; i < threads; ++i) {
+            threads_.emplace_back([this, i] { run(i); });
+        }
+
+        LOG_INFO("[FieldScheduler] started threads={} cores={}", threads, cores_.to_string());
+    }
+
+    void FieldScheduler::stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!running_) return;
+            running_ = false;
+        }
+        cv_.notify_all();
+
+        for (auto& t : threads_) {
+            if (t.joinable()) t.join();
+        }
+        threads_.clear();
+    }
+
+    void FieldScheduler::attach(Worker* w) {
+        attached_.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        w->schedState_.store(Worker::SchedState::Idle);
+        w->armedDeadline_ = {};
+        arm_timer_locked(w);
+        // 잠든 풀 스레드가 새 타이머를 보도록 깨운다 (메시지가 없는 필드도 틱이 돌아야 한다)
+        cv_.notify_one();
+        if (!w->mailbox_empty()) {
+            enqueue_locked(w);
+        }
+    }
+
+    void FieldScheduler::detach(Worker* w) {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        doneCv_.wait(lock, [w] {
+            return w->schedState_.load() != Worker::SchedState::Running;
+            });
+        w->schedState_.store(Worker::SchedState::Detached);
+
+        ready_.erase(std::remove(ready_.begin(), ready_.end(), w), ready_.end());
+
+        timers_.erase(std::remove_if(timers_.begin(), timers_.end(),
+            [w](const Timer& t) { return t.worker == w; }), timers_.end());
+        std::make_heap(timers_.begin(), timers_.end(), std::greater<Timer>());
+
+        attached_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void FieldScheduler::notify(Worker* w) {
+        auto expected = Worker::SchedState::Idle;
+        if (!w->schedState_.compare_exchange_strong(expected, Worker::SchedState::Queued))
+            return;   // 이미 큐에 있거나 실행 중 (실행 중이면 끝날 때 메일박스를 다시 본다)
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // 락 잡기 전에 detach 됐으면 넣지 않는다
+            if (w->schedState_.load() != Worker::SchedState::Queued) return;
+            ready_.push_back(w);
+        }
+        cv_.notify_one();
+    }
+
+    void FieldScheduler::enqueue_locked(Worker* w) {
+        auto expected = Worker::SchedState::Idle;
+        if (!w->schedState_.compare_exchange_strong(expected, Worker::SchedState::Queued))
+            return;
+        ready_.push_back(w);
+        cv_.notify_one();
+    }
+
+    // 다음 틱 마감을 타이머 힙에 건다 (같은 마감이 이미 걸려 있으면 생략)
+    void FieldScheduler::arm_timer_locked(Worker* w) {
+        if (!w->ticking_) return;
+        if (w->armedDeadline_ == w->nextTick_) return;
+
+        w->armedDeadline_ = w->nextTick_;
+        timers_.push_back(Timer{ w->nextTick_, w });
+        std::push_heap(timers_.begin(), timers_.end(), std::greater<Timer>());
+    }
+
+    void FieldScheduler::fire_timers_locked(std::chrono::steady_clock::time_point now) {
+        while (!timers_.empty() && timers_.front().deadline <= now) {
+            std::pop_heap(timers_.begin(), timers_.end(), std::greater<Timer>());
+            Worker* w = timers_.back().worker;
+            timers_.pop_back();
+
+            w->armedDeadline_ = {};
+            enqueue_locked(w);   // Queued/Running 이면 조각이 끝날 때 다시 건다
+        }
+    }
+
+    // 조각 하나가 끝난 워커를 다시 ready 로 돌리거나 Idle 로 내려놓는다
+    void FieldScheduler::finish_slice_locked(Worker* w, bool more) {
+        if (!w->running_.load(std::memory_order_acquire)) {
+            w->schedState_.store(Worker::SchedState::Idle);
+            doneCv_.notify_all();
+            return;
+        }
+
+        if (more) {
+            w->schedState_.store(Worker::SchedState::Queued);
+            ready_.push_back(w);
+            return;
+        }
+
+        w->schedState_.store(Worker::SchedState::Idle);
+        // notify() 의 CAS 와 짝: Idle 로 내린 뒤 메일박스를 다시 봐야 그 사이 push 를 놓치지 않는다
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!w->mailbox_empty()) {
+            enqueue_locked(w);
+            return;
+        }
+        arm_timer_locked(w);
+    }
+
+    void FieldScheduler::run(int idx) {
+        using clock = std::chrono::steady_clock;
+        ThreadStats& st = *stats_[idx];
+
+        // 필드 상태는 이 스레드가 처음 만질 때 이 코어의 NUMA 노드에 잡힌다
+        PinCurrentThread(cores_.pick(idx, static_cast<int>(stats_.size())));
+
+        // 필드 워커가 resolve 한 세션 포인터의 회수 시점 (QSBR): 조각 사이마다 정지점, 잠들면 offline
+        net::SessionReader reader;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (running_) {
+            const auto now = clock::now();
+            fire_timers_locked(now);
+
+            if (ready_.empty()) {
+                net::SessionEpoch::offline();
+                if (timers_.empty()) {
+                    cv_.wait(lock);
+                    continue;
+                }
+
+                // 마감 직전 구간은 맨 앞 타이머를 맡은 스레드 하나만 양보 spin (OS 타이머 오차 보정)
+                // 나머지 스레드는 마감까지 잠든다 (spin 스레드가 타이머를 터뜨리면 notify 로 깬다)
+                const auto deadline = timers_.front().deadline;
+                const auto wakeAt = deadline - timers_.front().worker->tickSpinMargin_;
+                if (now < wakeAt) {
+                    cv_.wait_until(lock, wakeAt);
+                    continue;
+                }
+                if (spinning_) {
+                    cv_.wait_until(lock, deadline);
+                    continue;
+                }
+
+                spinning_ = true;
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+                spinning_ = false;
+
+                st.spin_ns.fetch_add(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - now).count()),
+                    std::memory_order_relaxed);
+                continue;
+            }
+
+            Worker* w = ready_.front();
+            ready_.pop_front();
+            w->schedState_.store(Worker::SchedState::Running);
+            lock.unlock();
+
+            net::SessionEpoch::online();
+
+            const auto t0 = clock::now();
+            const Worker::Slice r = w->run_slice(w->drainBudget_);
+            const auto t1 = clock::now();
+
+            st.slices.fetch_add(1, std::memory_order_relaxed);
+            st.busy_ns.fetch_add(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()),
+                std::memory_order_relaxed);
+
+            // budget 을 다 썼거나 틱 마감이 이미 또 지났으면 바로 한 조각 더
+            const bool more = r.drained >= w->drainBudget_
+                || (w->ticking_ && w->nextTick_ <= t1);
+
+            lock.lock();
+            if (r.ticked) tickLate_.record(r.tickLateUs);
+            finish_slice_locked(w, more);
+        }
+    }
+
+    void FieldScheduler::log_stats() {
+        const auto now = std::chrono::steady_clock::now();
+        const double wallNs = double(std::chrono::duration_cast<std::chrono::nanoseconds>(now - statsLastTime_).count());
+        statsLastTime_ = now;
+
+        double busySum = 0.0;
+        double spinSum = 0.0;
+        for (std::size_t i = 0; i < stats_.size(); ++i) {
+            const std::uint64_t busy = stats_[i]->busy_ns.load(std::memory_order_relaxed);
+            const std::uint64_t delta = busy - statsLastBusy_[i];
+            statsLastBusy_[i] = busy;
+            busySum += wallNs > 0.0 ? double(delta) / wallNs : 0.0;
+
+            const std::uint64_t spin = stats_[i]->spin_ns.load(std::memory_order_relaxed);
+            const std::uint64_t spinDelta = spin - statsLastSpin_[i];
+            statsLastSpin_[i] = spin;
+            spinSum += wallNs > 0.0 ? double(spinDelta) / wallNs : 0.0;
+        }
+
+        LOG_INFO("[FieldScheduler] threads={} fields={} cpu={}% spin={}% (of {} cores) tick_late_us p50<={} p99<={} max={}",
+            stats_.size(), worker_count(),
+            busySum * 100.0, spinSum * 100.0, stats_.size(),
+            tickLate_.percentile_us(0.50), tickLate_.percentile_us(0.99), tickLate_.max_us());
+    }
+
+} // namespace core
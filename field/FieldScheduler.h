@@ -0,0 +1,90 @@
+// FieldScheduler.h
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/tick_histogram.h"
+#include "core/affinity.h"
+
+namespace core {
+
+    class Worker;
+
+    // 많은 FieldWorker 를 코어 수만큼의 스레드 풀에서 돌리는 M:N 스케줄러
+    //  - 워커는 메시지가 오거나(notify) 틱 마감이 되면(타이머) ready 큐에 한 번만 들어간다
+    //  - 풀 스레드는 ready 큐에서 하나를 꺼내 run_slice(budget) 한 조각만 돌리고 돌려놓는다
+    //    -> 한 워커는 동시에 한 스레드에서만 실행 (필드 단일 스레드 보장 유지)
+    //    -> FIFO ready 큐 + 조각 단위 실행이라 바쁜 필드가 다른 필드를 굶기지 않는다
+    class FieldScheduler {
+    public:
+        struct ThreadStats {
+            std::atomic<std::uint64_t> slices{ 0 };
+            std::atomic<std::uint64_t> busy_ns{ 0 };   // 워커를 실행한 시간
+            std::atomic<std::uint64_t> spin_ns{ 0 };   // 틱 마감 직전 양보 spin 한 시간 (busy 와 별도)
+        };
+
+        FieldScheduler() = default;
+        ~FieldScheduler();
+
+        FieldScheduler(const FieldScheduler&) = delete;
+        FieldScheduler& operator=(const FieldScheduler&) = delete;
+
+        // threads <= 0 이면 코어 수 (cores 가 있으면 그 개수)
+        // cores 가 있으면 풀 스레드를 그 안에 고정 (스레드 수 <= 코어 수면 스레드당 코어 1개)
+        void start(int threads, const CoreSet& cores = {});
+        void stop();
+
+        int thread_count() const { return static_cast<int>(threads_.size()); }
+        std::size_t worker_count() const { return attached_.load(std::memory_order_relaxed); }
+
+        // 풀 스레드별 CPU 사용률 / 틱 지연 분포
+        void log_stats();
+
+    private:
+        friend class Worker;
+
+        void attach(Worker* w);
+        void detach(Worker* w);   // 실행 중이면 끝날 때까지 기다린다
+        void notify(Worker* w);   // push() 후 호출: Idle 이면 ready 큐에 넣는다
+
+        void run(int idx);
+        void enqueue_locked(Worker* w);
+        void arm_timer_locked(Worker* w);
+        void fire_timers_locked(std::chrono::steady_clock::time_point now);
+        void finish_slice_locked(Worker* w, bool more);
+
+        struct Timer {
+            std::chrono::steady_clock::time_point deadline;
+            Worker* worker;
+            bool operator>(const Timer& o) const { return deadline > o.deadline; }
+        };
+
+    private:
+        std::mutex              mutex_;
+        std::condition_variable cv_;       // ready/타이머 변경
+        std::condition_variable doneCv_;   // detach 대기
+        std::deque<Worker*>     ready_;
+        std::vector<Timer>      timers_;   // min-heap (std::greater)
+        bool                    running_{ false };
+        bool                    spinning_{ false };   // 맨 앞 타이머를 spin 으로 기다리는 스레드가 있다 (최대 1개)
+
+        std::vector<std::thread>                   threads_;
+        std::vector<std::unique_ptr<ThreadStats>>  stats_;
+        std::atomic<std::size_t>                   attached_{ 0 };
+        CoreSet                                    cores_;
+
+        TickHistogram tickLate_;   // 틱 마감 대비 실제 실행 지연 (풀 전체)
+        std::chrono::steady_clock::time_point statsLastTime_{ std::chrono::steady_clock::now() };
+        std::vector<std::uint64_t>                 statsLastBusy_;
+        std::vector<std::uint64_t>                 statsLastSpin_;
+    };
+
+} // namespace core
@@ -0,0 +1,104 @@
+// field/MoveQuant.h
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace field {
+
+    // field::PackedMove 와 같은 값 (id 제외)
+    struct QuantMove {
+        std::int16_t  sx{ 0 };
+        std::int16_t  sy{ 0 };
+        std::uint16_t ox{ 0 };
+        std::uint16_t oy{ 0 };
+        std::uint8_t  heading{ 0 };
+        std::uint8_t  speed{ 0 };
+    };
+
+    // 압축 이동 인코딩 (field.fbs MoveBatch)
+    //  - 위치 = AOI 섹터 원점 + 16비트 오프셋 (unit 미터 단위)
+    //  - unit 은 precision 으로 정하되 섹터 한 변이 16비트 안에 들어가도록 아래를 막는다
+    //  - 방향 8비트 (360/256 도), 속도 0.1 m/s 8비트
+    //    속도 상한 kMaxSpeed (25.5 m/s). 넘으면 255 로 잘린다 (대시/넉백 등 더 빠른 이동은 fieldcmd 로)
+    //  - decode 는 클라 참조 구현: 위치 오차 <= unit/2, 방향 오차 <= 0.71도
+    class MoveQuantizer {
+    public:
+        static constexpr float kSpeedUnit = 0.1f;
+        static constexpr float kMaxSpeed = 255 * kSpeedUnit;
+        static constexpr float kTwoPi = 6.2831853f;
+
+        MoveQuantizer() = default;
+        MoveQuantizer(float sectorSize, float precision) { configure(sectorSize, precision); }
+
+        void configure(float sectorSize, float precision) {
+            sectorSize_ = sectorSize > 0.0f ? sectorSize : 1.0f;
+            unit_ = std::max(precision, sectorSize_ / 65535.0f);
+        }
+
+        float sector_size() const { return sectorSize_; }
+        float unit() const { return unit_; }
+        float max_pos_error() const { return unit_ * 0.5f; }
+
+        QuantMove encode(float x, float y, float dirX, float dirY, float speed) const {
+            QuantMove q;
+            encode_axis(x, q.sx, q.ox);
+            encode_axis(y, q.sy, q.oy);
+
+            const float len2 = dirX * dirX + dirY * dirY;
+            if (speed <= 0.0f || len2 < 1e-6f) return q;   // 정지: heading/speed 0
+
+            float angle = std::atan2(dirY, dirX);
+            if (angle < 0.0f) angle += kTwoPi;
+            q.heading = static_cast<std::uint8_t>(static_cast<int>(std::lround(angle / kTwoPi * 256.0f)) & 0xFF);
+
+            const long s = std::lround(speed / kSpeedUnit);
+            q.speed = static_cast<std::uint8_t>(std::clamp<long>(s, 1, 255));   // 움직이면 최소 1, kMaxSpeed 에서 잘림
+            return q;
+        }
+
+        void decode(const QuantMove& q, float& x, float& y, float& dirX, float& dirY, float& speed) const {
+            x = static_cast<float>(q.sx) * sectorSize_ + static_cast<float>(q.ox) * unit_;
+            y = static_cast<float>(q.sy) * sectorSize_ + static_cast<float>(q.oy) * unit_;
+
+            speed = static_cast<float>(q.speed) * kSpeedUnit;
+            if (q.speed == 0) {
+                dirX = dirY = 0.0f;
+                return;
+            }
+            const float angle = static_cast<float>(q.heading) * (kTwoPi / 256.0f);
+            dirX = std::cos(angle);
+            dirY = std::sin(angle);
+        }
+
+        // 시작 시 자기 점검: [0, extent) 격자 표본을 왕복시킨 최대 위치 오차 (m)
+        float self_check(float extent, int samples = 64) const {
+            float worst = 0.0f;
+            for (int i = 0; i < samples; ++i) {
+                for (int j = 0; j < samples; ++j) {
+                    const float x = extent * (static_cast<float>(i) + 0.37f) / static_cast<float>(samples);
+                    const float y = extent * (static_cast<float>(j) + 0.61f) / static_cast<float>(samples);
+
+                    float dx, dy, ddx, ddy, ds;
+                    decode(encode(x, y, 1.0f, 0.0f, 1.0f), dx, dy, ddx, ddy, ds);
+                    worst = std::max(worst, std::max(std::fabs(dx - x), std::fabs(dy - y)));
+                }
+            }
+            return worst;
+        }
+
+    private:
+        void encode_axis(float v, std::int16_t& sector, std::uint16_t& offset) const {
+            const float fs = std::clamp(std::floor(v / sectorSize_), -32768.0f, 32767.0f);
+            const long o = std::lround((v - fs * sectorSize_) / unit_);
+
+            sector = static_cast<std::int16_t>(fs);
+            offset = static_cast<std::uint16_t>(std::clamp<long>(o, 0, 65535));
+        }
+
+        float sectorSize_{ 1.0f };
+        float unit_{ 0.01f };
+    };
+
+} // namespace field
@@ -16,7 +16,7 @@ namespace monster_ecs {
         int sp = 50;        
         int atk = 7;
         int def = 0;
-		bool dirty = false;//   ˸ ʿ 
+		bool dirty = false;// 스탯 변경 알림 필요 여부
     };
 
     struct CMonsterTag {
@@ -26,9 +26,9 @@ namespace monster_ecs {
     struct CSpawnInfo {
         float spawnX = 0.0f;
         float spawnY = 0.0f;
-        float respawnDelay;   //    
-        bool  pendingRespawn; //   
-        float respawnTimer;   //  ð
+        float respawnDelay;   // 몇 초 후 리스폰할지
+        bool  pendingRespawn; // 리스폰 대기 중인지
+        float respawnTimer;   // 누적 시간
         float deadTimer = 0.0f;
     };
 
@@ -48,15 +48,15 @@ namespace monster_ecs {
         float attackCooldown{ 1.0f };
         float attackTimer{ 0.0f };
 
-        // Idle/Patrol/Return   Ÿ̸ӷ  (roamTimer ü)
+        // Idle/Patrol/Return 상태 유지 타이머로 사용 (roamTimer 대체)
         float idlePatrolTimer{ 0.f };
 
-        // ̵ /ӵ (roamDirX/Y ü)
+        // 이동 방향/속도 (roamDirX/Y 대체)
         float moveDirX{ 0.f };
         float moveDirY{ 0.f };
         float moveSpeed{ 0.f };
-        bool netSynced = false; //  ȭ
-        // ͺ RNG õ ()
+        bool netSynced = false; // 최초 동기화용
+        // 몬스터별 RNG 시드 (유지)
         uint32_t rng = 0x12345678u;
         float attackCd = 0.0f;
     };
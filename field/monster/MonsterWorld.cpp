@@ -21,16 +21,16 @@ namespace monster_ecs {
         monsters.push_back(e);
 
         transform.add(e, { x, y });
-        stats.add(e, {  maxHp,  hp , maxSp,  sp,  atk,  def });                      // ⺻ 
+        stats.add(e, {  maxHp,  hp , maxSp,  sp,  atk,  def });                      // 기본 스탯
 
-        // ⼭ Ÿ 
+        // 여기서 타입 세팅
         monster_ecs::CMonsterTag tag{};
         tag.monsterType = monsterType;
         monsterTag.add(e, tag);
 
-        spawnInfo.add(e, { x, y });            // spawn ġ
-        aiComp.add(e, {});                     // ⺻ Idle
-        prefabNameComp.add(e, { prefab });     //  ̸
+        spawnInfo.add(e, { x, y });            // spawn 위치
+        aiComp.add(e, {});                     // 기본 Idle
+        prefabNameComp.add(e, { prefab });     // 프리팹 이름
 
         return e;
     }
@@ -71,15 +71,15 @@ namespace monster_ecs {
             {
                 st.hp = 0;
 
-                //  ó
+                // 죽음 처리
                 kill_monster(e);
 
-                //   ON (SpawnSystem  ʿ)
+                // 리스폰 대기 ON (SpawnSystem이 보려면 필요)
                 auto& sp = spawnInfo.get(e);
                 sp.pendingRespawn = true;
                 sp.respawnTimer = 0.0f;
 
-                // AOI  (Ŭ Leave  Destroy)
+                // AOI에서 제거 (클라에 Leave 나가서 Destroy됨)
                 if (env.removeFromAoi)
                     env.removeFromAoi(e);
 
@@ -4,8 +4,8 @@
 #include "Components.h"
 #include "core_types.h"
 #include "MonsterEnvironment.h"
-#include "proto/generated/field_generated.h" // FieldCmd, Vec2 
-#include "proto/generated/game_generated.h" // FieldCmd, Vec2 
+#include "proto/generated/field_generated.h" // FieldCmd, Vec2 등
+#include "proto/generated/game_generated.h" // FieldCmd, Vec2 등
 
 namespace monster_ecs {
 
@@ -15,7 +15,7 @@ namespace monster_ecs {
     class MovementSystem;
     class CombatSystem;
 
-    using Entity = std::uint64_t;   // databaseid ״ Entity 
+    using Entity = std::uint64_t;   // databaseid를 그대로 Entity로 사용
 
     static field::AiStateType to_fb_state(monster_ecs::CAI::State s)
     {
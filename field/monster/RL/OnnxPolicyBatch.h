@@ -34,7 +34,7 @@ public:
 
         session_ = Ort::Session(env_, modelPath.c_str(), so);
 
-        // ̸ char* ޾Ƽ std::string   Free
+        // 이름은 char* 받아서 std::string으로 복사 후 Free
         inName_ = GetInputName_C(session_, 0);                
 
         outLogitsName_ = GetOutputName_C(session_, 0);
@@ -66,7 +66,7 @@ public:
             logitsShape.size()
         );
 
-        // value    output 2  ޴  
+        // value는 안 쓰더라도 모델 output이 2개라 같이 받는 게 안전
         scratchValue_.resize((size_t)N);
         std::vector<int64_t> valueShape{ (int64_t)N, 1 };
         Ort::Value outValue = Ort::Value::CreateTensor<float>(
@@ -88,7 +88,7 @@ public:
         );
 
         if (valueBatch) {
-            *valueBatch = scratchValue_; // ʿ  
+            *valueBatch = scratchValue_; // 필요할 때만 복사
         }
     }
 
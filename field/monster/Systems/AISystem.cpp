@@ -7,7 +7,7 @@ static ObsParams g_obsP;
 
 static OnnxPolicyBatch& GetPolicy()
 {    
-    static OnnxPolicyBatch pol(L"G:\\ڵ\\PJserver\\server_all\\Build\\x64\\Debug\\policy_logits_value.onnx", 16, 5, 1);
+    static OnnxPolicyBatch pol(L"G:\\코드\\PJserver\\server_all\\Build\\x64\\Debug\\policy_logits_value.onnx", 16, 5, 1);
     //static OnnxPolicyBatch pol(L"policy_logits_value.onnx", 16, 5, 1);
     return pol;
 }
@@ -24,12 +24,12 @@ namespace monster_ecs {
             ai.attackCd = std::max(0.0f, ai.attackCd - dt);
             const bool isArcher = (ty.monsterType == 1);
             if (!ai.netSynced) {
-                // ʱ ° ,  ai.state  ѹ 
+                // 초기 상태가 뭐든, 현재 ai.state 기준으로 한번은 보내자
                 env.broadcastAiState(e, ai.state);
                 env.broadcastMonsterStat(e, st.hp, st.maxHp, st.sp, st.maxSp);
-                // Idle/Attack/Dead   Ŷ ѹ 
+                // Idle/Attack/Dead면 무조건 정지 패킷도 한번 보냄
                 if (ai.state == CAI::State::Idle || ai.state == CAI::State::Attack || ai.state == CAI::State::Dead) {
-                    stop_move(e, ai, env); // set_monster_move(0,0,0) 
+                    stop_move(e, ai, env); // set_monster_move(0,0,0) 포함
                 }
                 else {                                       
                     env.set_monster_move(e, ai.moveDirX, ai.moveDirY, patrol_speed(isArcher));
@@ -38,13 +38,13 @@ namespace monster_ecs {
                 ai.netSynced = true;
             }
 
-            //  dirty 
+            // 스탯 dirty 전송
             if (st.dirty) {
                 env.broadcastMonsterStat(e, st.hp, st.maxHp, st.sp, st.maxSp);
                 st.dirty = false;
             }
 
-            //  ó
+            // 죽음 처리
             if (st.hp <= 0) {
                 ai.state = CAI::State::Dead;
                 ai.targetId = 0;
@@ -66,7 +66,7 @@ namespace monster_ecs {
             float keepAttackRange = isArcher ? 12.0f : 1.8f;
 
             // ----------------------------
-            // Ÿ :  Ÿ 켱,   Ž
+            // 타겟 고정: 기존 타겟 우선, 실패 시 재탐색
             // ----------------------------
             uint64_t target = ai.targetId;
 
@@ -92,7 +92,7 @@ namespace monster_ecs {
                 }
             }
             if (target && hasTargetPos) {
-                // õ: sightRange 1.4迡 ߰ 
+                // 추천: sightRange의 1.4배에서 추격 포기
                 const float disengageMul = 1.4f;
                 const float disengageRange = sightRange * disengageMul;
                 const float disengageRangeSq = disengageRange * disengageRange;
@@ -101,7 +101,7 @@ namespace monster_ecs {
                 float ddy = py - tr.y;
                 float distSq = ddx * ddx + ddy * ddy;
 
-                // ʹ ־ Ÿ  + ι 
+                // 너무 멀어지면 타겟 해제 + 로밍 복귀
                 if (distSq > disengageRangeSq) {
                     ai.targetId = 0;
                     target = 0;
@@ -109,7 +109,7 @@ namespace monster_ecs {
                     ai.state = CAI::State::Idle;
                     stop_move(e, ai, env);
 
-                    //  ƽ 7:3 ι ÷
+                    // 다음 틱에 7:3 로밍 재추첨
                     ai.idlePatrolTimer = 0.f;
 
                     if (ai.state != oldState)
@@ -119,7 +119,7 @@ namespace monster_ecs {
                 }
             }
             // ----------------------------
-            // lowHP Return() 켱 +  Ÿ   
+            // lowHP면 Return(도망) 우선 + 일정 거리 도망 후 종료
             // ----------------------------
             const float lowHpRatio = 0.25f;
             const bool lowHp = (st.maxHp > 0) && (float(st.hp) / float(st.maxHp) <= lowHpRatio);
@@ -127,12 +127,12 @@ namespace monster_ecs {
             if (lowHp) {
                 ai.state = CAI::State::Return;
 
-                // ּ  ð
+                // 최소 도망 유지시간
                 const float fleeMinTime = 1.2f;
                 if (ai.idlePatrolTimer <= 0.f) ai.idlePatrolTimer = fleeMinTime;
                 else ai.idlePatrolTimer = std::max(0.f, ai.idlePatrolTimer - ai.thinkCooldown);
 
-                //  ־   -> Idle
+                // 충분히 멀어지면 도망 종료 -> Idle
                 if (target && hasTargetPos) {
                     float dx = px - tr.x;
                     float dy = py - tr.y;
@@ -145,14 +145,14 @@ namespace monster_ecs {
                         ai.targetId = 0;
                         ai.state = CAI::State::Idle;
                         stop_move(e, ai, env);
-                        ai.idlePatrolTimer = 0.f; //  ƽ ι ÷
+                        ai.idlePatrolTimer = 0.f; // 다음 틱에 로밍 재추첨
                         if (ai.state != oldState)
                             env.broadcastAiState(e, ai.state);
                         continue;
                     }
                 }
 
-                //  
+                // 도망 방향
                 float dirX = ai.moveDirX;
                 float dirY = ai.moveDirY;
 
@@ -188,7 +188,7 @@ namespace monster_ecs {
             }
 
             // ----------------------------
-            //  Ÿ : Patrol/Idle 7:3 ι
+            //  타겟 없으면: Patrol/Idle 7:3 로밍
             // ----------------------------
             if (!target) {
                 if (ai.idlePatrolTimer <= 0.f) {
@@ -226,7 +226,7 @@ namespace monster_ecs {
             }
 
             // ----------------------------
-            // Ÿ :  
+            // 타겟 있으면: 전투 로직
             // ----------------------------
             if (!hasTargetPos) {
                 ai.targetId = 0;
@@ -266,24 +266,24 @@ namespace monster_ecs {
                 }
                 else {
                     ai.state = CAI::State::Chase;
-                    ai.moveSpeed = chase_speed(true); //  MovementSystem Ÿ  
+                    ai.moveSpeed = chase_speed(true); // 방향은 MovementSystem이 타겟 보고 계산
                     env.set_monster_move(e, ai.moveDirX, ai.moveDirY, ai.moveSpeed);
                 }
             }
             else {
 
-                // ===== RL   =====
+                // ===== RL로 상태 선택 =====
                 float dist = (distSq > 1e-12f) ? std::sqrt(distSq) : 0.0f;
 
                 float obs[16];
                 MakeObs16(
                     obs,
-                    true,               // hasTarget (  target+pos )
+                    true,               // hasTarget (여기 도달했으면 target+pos 있음)
                     tr.x, tr.y,
                     px, py,
                     (float)st.hp, (float)st.maxHp,
-                    ai.attackCd,        // CombatSystem  0.9 ⼭   ٽ
-                    (RLState)oldState,  // last_action =  
+                    ai.attackCd,        // CombatSystem이 세팅한 0.9를 여기서 쓰는 게 핵심
+                    (RLState)oldState,  // last_action = 직전 상태
                     g_obsP
                 );
 
@@ -293,24 +293,24 @@ namespace monster_ecs {
 
                 ai.state = (CAI::State)a;                 // Idle/Patrol/Chase/Attack/Return
 
-                // =====   Ʈ =====
-                //   Patrol  Idle ()
+                // ===== 서버 안전 게이트 =====
+                // 전투 중 Patrol 나오면 Idle로 (안정)
                 if (ai.state == CAI::State::Patrol) ai.state = CAI::State::Idle;
 
-                // Attack "Ÿ + ٿ"   
+                // Attack은 "사거리 + 쿨다운" 만족할 때만 허용
                 if (ai.state == CAI::State::Attack) {
                     if (!(dist <= g_obsP.attack_range && ai.attackCd <= 0.0f)) {
                         ai.state = CAI::State::Chase;
                     }
                 }
 
-                // Return lowhp ƴ  Chase
+                // Return은 lowhp 아닐 때는 Chase로
                 float hpRatio = (st.maxHp > 0) ? (float(st.hp) / float(st.maxHp)) : 0.0f;
                 if (ai.state == CAI::State::Return && hpRatio > g_obsP.low_hp_ratio) {
                     ai.state = CAI::State::Chase;
                 }
 
-                // =====   =====
+                // ===== 상태 실행 =====
                 if (ai.state == CAI::State::Idle) {
                     stop_move(e, ai, env);
                 }
@@ -319,7 +319,7 @@ namespace monster_ecs {
                     env.set_monster_move(e, ai.moveDirX, ai.moveDirY, ai.moveSpeed);
                 }
                 else if (ai.state == CAI::State::Return) {
-                    // Ÿ ݴ 
+                    // 타겟 반대 방향
                     if (distSq > 1e-6f) {
                         float inv = 1.f / std::sqrt(distSq);
                         ai.moveDirX = -dx * inv;
@@ -330,13 +330,13 @@ namespace monster_ecs {
                 }
                 else if (ai.state == CAI::State::Attack) {
                     stop_move(e, ai, env);
-                    // / CombatSystem 
+                    // 데미지/판정은 CombatSystem이 함
                 }
 
-                // () α: 1ʿ 1 
+                // (선택) 로그: 1초에 1번 정도만
                 // if ((ecs.frameCount % 20) == 0) printf("dist=%.2f cd=%.2f a=%d state=%d\n", dist, ai.attackCd, a, (int)ai.state);
 
-                //
+                //기존로직
                 /*if (ai.state == CAI::State::Attack) {
                     if (distSq > keepAttackRangeSq)
                         ai.state = CAI::State::Chase;
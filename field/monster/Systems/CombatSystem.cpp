@@ -10,15 +10,15 @@ namespace monster_ecs {
             auto& ai = ecs.aiComp.get(e);
             
             if (ai.state != CAI::State::Attack) {
-                //  ° ƴϸ Ÿ̸ ʱȭ
+                // 공격 상태가 아니면 타이머 초기화
                 ai.attackTimer = 0.0f;
                 continue;
             }
 
-            //  Ÿ 
+            // 공격 쿨타임 누적
             ai.attackTimer += dt;
             if (ai.attackTimer < ai.attackCooldown) {
-                //    á н
+                // 아직 쿨 안 찼으면 패스
                 continue;
             }
 
@@ -30,7 +30,7 @@ namespace monster_ecs {
             int damage = st.atk;
 			
 
-            // HP   env.broadcastCombat ȿ ó
+            // HP 깎는 건 env.broadcastCombat 안에서 처리
 			attack_player(e, ai.targetId, ecs, env);
             ai.attackCd = 0.9f;
 
@@ -48,7 +48,7 @@ namespace monster_ecs {
         if (!env_.getPlayerStats(playerId, hp, maxHp, sp, maxSp))
             return; // invalid
 
-        // ===   ===
+        // === 데미지 계산 ===
         auto& mon = monsterWorld_.stats.get(monsterId);
         const int dmg = mon.atk;
 
@@ -59,19 +59,19 @@ namespace monster_ecs {
         const bool spChanged = (newSp != sp);
         const bool statChanged = (hpChanged || spChanged);
 
-        //     ݿ
+        // 변경 있을 때만 실제 반영
         if (statChanged) {
             env_.setPlayerStats(playerId, newHp, newSp);
 
-            //    dirty (ϰ nullptr üũ)
+            // 변경 있을 때만 dirty (안전하게 nullptr 체크)
             if (env_.markPlayerDirty) env_.markPlayerDirty(playerId);
         }
 
-        //  εĳƮ  ߻ ü ǹ̶ 
+        // 전투 브로드캐스트는 “공격 발생” 자체가 의미라면 유지
 
         env_.broadcastCombat(monsterId, playerId, dmg, newHp);
 
-        //  Ŷ        
+        // 스탯 패킷도 변경 있을 때만 보내는 게 보통 더 맞음
         if (statChanged) {
             env_.broadcastPlayerStat(playerId, newHp, maxHp, newSp, maxSp);
         }
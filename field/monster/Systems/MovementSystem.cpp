@@ -11,7 +11,7 @@ namespace monster_ecs {
             auto& ai = ecs.aiComp.get(e);
             auto& tr = ecs.transform.get(e);
 
-            //  ´   (Idle ǥ ϴ  ⼭ )
+            // 정지 상태는 무조건 정지 (Idle에서도 좌표 변하는 문제 여기서 차단)
             if (ai.state == CAI::State::Idle ||
                 ai.state == CAI::State::Attack ||
                 ai.state == CAI::State::Dead)
@@ -28,7 +28,7 @@ namespace monster_ecs {
             if (ai.state == CAI::State::Chase) {
                 float px, py;
                 if (!ai.targetId || !env.getPlayerPosition(ai.targetId, px, py)) {
-                    // Ÿ  ̵ 
+                    // 타겟 없으면 이동 중지
                     stop_move(e, ai, env);
                     continue;
                 }
@@ -44,23 +44,23 @@ namespace monster_ecs {
                 dirX = dx * inv;
                 dirY = dy * inv;
 
-                // AI speed      ⺻ 
+                // AI가 speed 세팅 안 했을 수도 있으니 기본값 보정
                 if (speed <= 0.f) speed = 6.0f;
             }
-            // Patrol/Return AI   ̵
+            // Patrol/Return은 AI가 만들어둔 방향으로 이동
             else if (ai.state == CAI::State::Patrol || ai.state == CAI::State::Return) {
                 dirX = ai.moveDirX;
                 dirY = ai.moveDirY;
 
                 float len2 = dirX * dirX + dirY * dirY;
                 if (len2 < 1e-6f || speed <= 0.f) {
-                    // /ӵ  
+                    // 방향/속도 없으면 멈춤
                     stop_move(e, ai, env);
                     continue;
                 }
             }
             else {
-                //    ¸ ϰ 
+                // 알 수 없는 상태면 안전하게 정지
                 stop_move(e, ai, env);
                 continue;
             }
@@ -68,7 +68,7 @@ namespace monster_ecs {
             tr.x += dirX * speed * dt;
             tr.y += dirY * speed * dt;
 
-            // AOI  ̵ ýۿ
+            // AOI 갱신은 이동 시스템에서만
             env.moveInAoi(e, tr.x, tr.y);
 
             ai.moveDirX = dirX;
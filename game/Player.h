@@ -17,13 +17,13 @@ namespace core {
     };
 
 
-    // ÷̾ ̵  (  ̵)
+    // 플레이어 이동 상태 (서버 권한 이동용)
     struct PlayerMoveState
     {
-        Vec2     dir{ 0.0f, 0.0f };  //  Է (ȭ)
-        bool     moving{ false };    // ̵  
-        float    speed{ PLAYER_SPEED };      // / (ʿ  )
-        float    lastInputTime{ 0 }; //  ð
+        Vec2     dir{ 0.0f, 0.0f };  // 마지막 입력 방향(정규화)
+        bool     moving{ false };    // 이동 중인지 여부
+        float    speed{ PLAYER_SPEED };      // 유닛/초 (필요 시 변경)
+        float    lastInputTime{ 0 }; // 서버 시각
     };
 
     struct PlayerStat
@@ -57,10 +57,14 @@ namespace core {
         void set_field_id(int fieldId) { fieldId_ = fieldId; }
         int  field_id() const { return fieldId_; }
 
+        // 현재 필드 워커의 watcher 칸 번호 (필드 스레드 전용, UINT32_MAX = 없음)
+        void          set_field_slot(std::uint32_t slot) { fieldSlot_ = slot; }
+        std::uint32_t field_slot() const { return fieldSlot_; }
+
         const std::string& prefab_name() const { return prefabName_; }
         void set_prefab_name(const std::string& p) { prefabName_ = p; }
 
-        // --- ġ  ---
+        // --- 위치 관련 ---
         void set_pos(float x, float y)
         {
             pos_.x = x;
@@ -71,14 +75,14 @@ namespace core {
         float x() const { return pos_.x; }
         float y() const { return pos_.y; }
 
-        // --- ̵   ---
+        // --- 이동 상태 관련 ---
         PlayerMoveState& move_state() { return moveState_; }
         const PlayerMoveState& move_state() const { return moveState_; }
 
         void set_speed(float s) { moveState_.speed = s; }
         void stop_move() { moveState_.moving = false; }
 
-        // --- /HP ---
+        // --- 스탯/HP ---
         const PlayerStat& stat() const { return stat_; }
         const PlayerStat& player_stat() const { return stat_; }
 
@@ -118,9 +122,10 @@ namespace core {
         std::shared_ptr<net::Session> session_;
         std::string                   name_;
         std::string                 prefabName_;
-        int                           fieldId_{ 0 }; // 0 =  ʵ 
-        Vec2                          pos_;          // ʵ  ġ
-        PlayerMoveState               moveState_;    // ̵ 
+        int                           fieldId_{ 0 }; // 0 = 아직 필드 없음
+        std::uint32_t                 fieldSlot_{ UINT32_MAX };
+        Vec2                          pos_;          // 필드 내 위치
+        PlayerMoveState               moveState_;    // 이동 상태
         PlayerStat                    stat_;
         double last_dirty_mark_time_{ 0.0 };
     };
@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include "game/Player.h"
 
 namespace core {
@@ -14,24 +15,28 @@ namespace core {
             return inst;
         }
 
-        //   ÷̾ ã
+        // 세션 기준으로 플레이어 찾기
         Player::Ptr get_by_session(net::Session* sess);
 
-        // ID  ã
+        // ID 기준으로 찾기
         Player::Ptr get_by_id(uint64_t id);
 
-        // α  Player  + 
+        // 새 플레이어 ID (GameWorker 샤드 여러 개가 동시에 로그인을 처리하므로 atomic)
+        uint64_t allocate_id() { return nextId_.fetch_add(1, std::memory_order_relaxed); }
+
+        // 로그인 시 Player 생성 + 등록
         Player::Ptr create_player(uint64_t id,
             const std::string& name,
             std::shared_ptr<net::Session> sess);
 
-        // α׾ƿ/   
+        // 로그아웃/세션 끊김 시 제거
         void remove_by_session(net::Session* sess);
         void remove_by_id(uint64_t id);
 
     private:
         PlayerManager() = default;
 
+        std::atomic<uint64_t> nextId_{ 1 };   // 0 = 로그인 전
         std::mutex mtx_;
         std::unordered_map<uint64_t, Player::Ptr> playersById_;
         std::unordered_map<net::Session*, uint64_t> idBySession_;
@@ -0,0 +1,83 @@
+// net/read_buffer_pool.h
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace net {
+
+    // I/O 루프 하나가 공유하는 소켓 read 버퍼 풀
+    //  - alloc_cb 에서 slab 을 빌려주고 read_cb 가 끝나면 바로 돌려받는다
+    //  - 한 루프에서 read 는 하나씩 처리되므로 실제로 도는 slab 은 루프당 1~2개
+    //  - 세션은 끝나지 않은 프레임 꼬리만 개인 버퍼로 들고 있는다 (tail bytes 로 집계)
+    //  - acquire/release 는 루프 스레드 전용, 통계는 다른 스레드에서 읽어도 된다
+    class ReadBufferPool {
+    public:
+        explicit ReadBufferPool(std::size_t slabSize = 64 * 1024, std::size_t maxCached = 4)
+            : slabSize_(slabSize)
+            , maxCached_(maxCached)
+        {
+        }
+
+        ~ReadBufferPool() {
+            for (auto* p : free_) delete[] p;
+        }
+
+        ReadBufferPool(const ReadBufferPool&) = delete;
+        ReadBufferPool& operator=(const ReadBufferPool&) = delete;
+
+        std::size_t slab_size() const { return slabSize_; }
+
+        char* acquire() {
+            char* p = nullptr;
+            if (!free_.empty()) {
+                p = free_.back();
+                free_.pop_back();
+            }
+            else {
+                p = new char[slabSize_];
+                slabs_.fetch_add(1, std::memory_order_relaxed);
+            }
+            inUse_.fetch_add(1, std::memory_order_relaxed);
+            return p;
+        }
+
+        void release(char* p) {
+            if (!p) return;
+            inUse_.fetch_sub(1, std::memory_order_relaxed);
+
+            if (free_.size() < maxCached_) {
+                free_.push_back(p);
+                return;
+            }
+            delete[] p;
+            slabs_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // 세션 개인 꼬리 버퍼 용량 변화 집계
+        void add_tail_bytes(std::ptrdiff_t delta) {
+            tailBytes_.fetch_add(delta, std::memory_order_relaxed);
+        }
+
+        // ----- 통계 -----
+        std::size_t slab_count() const { return slabs_.load(std::memory_order_relaxed); }
+        std::size_t slabs_in_use() const { return inUse_.load(std::memory_order_relaxed); }
+        std::size_t slab_bytes() const { return slab_count() * slabSize_; }
+        std::size_t tail_bytes() const {
+            auto v = tailBytes_.load(std::memory_order_relaxed);
+            return v > 0 ? static_cast<std::size_t>(v) : 0;
+        }
+
+    private:
+        std::size_t        slabSize_;
+        std::size_t        maxCached_;
+        std::vector<char*> free_;
+
+        std::atomic<std::size_t>    slabs_{ 0 };
+        std::atomic<std::size_t>    inUse_{ 0 };
+        std::atomic<std::ptrdiff_t> tailBytes_{ 0 };
+    };
+
+} // namespace net
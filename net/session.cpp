@@ -6,14 +6,17 @@
 #include "worker/worker.h"
 #include "worker/codec.h"
 #include "worker/fieldWorker.h"
+#include "core/proto/frame_route.h"
+#include "core/log.h"
 
-#include <iostream>
+#include <algorithm>
 
 namespace net {
 
-    Session::Session(uv_loop_t* loop, core::Dispatcher* disp)
+    Session::Session(uv_loop_t* loop, core::Dispatcher* disp, ReadBufferPool* readPool)
         : loop_(loop)
         , dispatcher_(disp)
+        , read_pool_(readPool)
         , state_(SessionState::Connected)
         , fieldId_(0)
     {
@@ -22,12 +25,12 @@ namespace net {
         uv_tcp_init(loop_, &client_);
         client_.data = this;
 
-        recv_buf_.reserve(64 * 1024);
         send_async_.data = this;
         uv_async_init(loop_, &send_async_, &Session::on_send_async);
     }
 
     Session::~Session() {
+        for (auto* wr : free_write_reqs_) delete wr;
     }
 
     uv_stream_t* Session::stream() {
@@ -39,19 +42,35 @@ namespace net {
     }
 
 
+    void Session::close() {
+        if (closing_) return;
+
+        uv_read_stop(stream());
+        closing_ = true;
+
+        uv_close(reinterpret_cast<uv_handle_t*>(&send_async_), nullptr);
+
+        uv_close(reinterpret_cast<uv_handle_t*>(&client_), &Session::close_cb);
+    }
+
     void Session::alloc_cb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
+        (void)suggested_size;
         auto* self = reinterpret_cast<Session*>(handle->data);
-        self->scratch_.resize(suggested_size);
-        *buf = uv_buf_init(
-            reinterpret_cast<char*>(self->scratch_.data()),
-            static_cast<unsigned>(suggested_size)
-        );
+
+        // 루프 공유 slab 을 빌려준다 (read_cb 끝에서 반납)
+        char* p = self->read_pool_->acquire();
+        *buf = uv_buf_init(p, static_cast<unsigned>(self->read_pool_->slab_size()));
     }
 
     void Session::read_cb(uv_stream_t* s, ssize_t nread, const uv_buf_t* buf) {
         auto* self = reinterpret_cast<Session*>(s->data);
         auto  session = self->shared_from_this();
         session->on_read(nread, buf);
+
+        // nread <= 0 이어도 alloc_cb 에서 빌려준 slab 은 돌려받아야 한다
+        if (buf && buf->base) {
+            session->read_pool_->release(buf->base);
+        }
     }
 
     void Session::close_cb(uv_handle_t* handle) {
@@ -62,94 +81,269 @@ namespace net {
 
     void Session::on_read(ssize_t nread, const uv_buf_t* buf) {
         if (nread < 0) {
-            uv_read_stop(stream());
-            closing_ = true;
-
-            uv_close(reinterpret_cast<uv_handle_t*>(&send_async_), nullptr);
-
-            uv_close(reinterpret_cast<uv_handle_t*>(&client_), &Session::close_cb);
+            close();
             return;
         }
         if (nread == 0) return;
 
-        recv_buf_.insert(
-            recv_buf_.end(),
-            reinterpret_cast<const uint8_t*>(buf->base),
-            reinterpret_cast<const uint8_t*>(buf->base) + nread
-        );
+        const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(buf->base);
+        const std::size_t   size = static_cast<std::size_t>(nread);
+        std::size_t         offset = 0;
 
-        std::size_t offset = 0;
+        // 1) 지난번에 남긴 꼬리 프레임부터 완성
+        if (!tail_.empty()) {
+            if (!append_tail(data, size, offset)) {
+                close();
+                return;
+            }
+            if (!tail_.empty())
+                return;   // 아직 프레임이 다 안 들어옴
+        }
 
-        while (true) {
-            if (recv_buf_.size() - offset < proto::Frame::kHeader)
+        // 2) slab 안에서 제자리 파싱
+        while (size - offset >= proto::Frame::kHeader) {
+            uint32_t len = proto::Frame::read_len(data + offset);
+            if (len > kMaxFrameBytes) {
+                LOG_WARN_RATE(10, "[SV] frame too large len={} session={}", len, id_);
+                close();
+                return;
+            }
+            if (size - offset - proto::Frame::kHeader < len)
                 break;
 
-            uint32_t len = proto::Frame::read_len(recv_buf_.data() + offset);
-            if (recv_buf_.size() - offset - proto::Frame::kHeader < len)
-                break;
+            route_frame(data + offset + proto::Frame::kHeader, len);
+            offset += proto::Frame::kHeader + len;
+        }
 
-            const uint8_t* payload =
-                recv_buf_.data() + offset + proto::Frame::kHeader;
+        // 3) 끝나지 않은 프레임만 개인 꼬리 버퍼로 옮긴다
+        if (offset < size) {
+            const std::size_t before = tail_.capacity();
+            tail_.assign(data + offset, data + size);
+            read_pool_->add_tail_bytes(
+                static_cast<std::ptrdiff_t>(tail_.capacity()) - static_cast<std::ptrdiff_t>(before));
+        }
+    }
 
-            if (gameWorker_) {
-                core::NetMessage msg;
-                msg.session = shared_from_this();
-                msg.payload.assign(payload, payload + len);
+    // 꼬리 버퍼에 필요한 만큼만 이어 붙이고, 프레임이 완성되면 처리 후 비운다
+    // used: data 에서 소비한 바이트 수 / 반환 false = 잘못된 프레임
+    bool Session::append_tail(const std::uint8_t* data, std::size_t n, std::size_t& used) {
+        const std::size_t before = tail_.capacity();
 
-                if (state_ == SessionState::InField) {
-                    if (IsSkillEnvelope(payload, len)) {
-                        msg.type = core::MessageType::NetEnvelope;
-                        gameWorker_->push(std::move(msg));
-                        // std::cout << "[SV] Skill Envelope(InField) -> GameWorker\n";
-                    }
-                    else if (IsFieldCmd(payload, len)) {
-                        msg.type = core::MessageType::Custom;
-                        core::SendToFieldWorker(fieldId_, std::move(msg));
-                        // std::cout << "[SV] FieldCmd(InField) -> FieldWorker\n";
-                    }
-                    else {
-                        std::cout << "[SV] Unknown payload in InField len=" << len << "\n";
-                    }
-                }
-                else {
-                    if (IsEnvelope(payload, len)) {
-                        msg.type = core::MessageType::NetEnvelope;
-                        gameWorker_->push(std::move(msg));
-                        // std::cout << "[SV] Envelope -> GameWorker\n";
-                    }
-                    else {
-                        std::cout << "[SV] verify_envelope FAILED len=" << len << "\n";
-                    }
-                }
+        if (tail_.size() < proto::Frame::kHeader) {
+            const std::size_t take = std::min<std::size_t>(proto::Frame::kHeader - tail_.size(), n - used);
+            tail_.insert(tail_.end(), data + used, data + used + take);
+            used += take;
+        }
+
+        if (tail_.size() >= proto::Frame::kHeader) {
+            uint32_t len = proto::Frame::read_len(tail_.data());
+            if (len > kMaxFrameBytes) {
+                LOG_WARN_RATE(10, "[SV] frame too large len={} session={}", len, id_);
+                return false;
             }
 
-            offset += proto::Frame::kHeader + len;
+            const std::size_t frameSize = proto::Frame::kHeader + len;
+            const std::size_t take = std::min<std::size_t>(frameSize - tail_.size(), n - used);
+            tail_.insert(tail_.end(), data + used, data + used + take);
+            used += take;
+
+            if (tail_.size() == frameSize) {
+                route_frame(tail_.data() + proto::Frame::kHeader, len);
+                tail_.clear();
+            }
         }
 
-        if (offset > 0) {
-            recv_buf_.erase(
-                recv_buf_.begin(),
-                recv_buf_.begin() + static_cast<long long>(offset)
-            );
+        read_pool_->add_tail_bytes(
+            static_cast<std::ptrdiff_t>(tail_.capacity()) - static_cast<std::ptrdiff_t>(before));
+
+        // 큰 프레임 때문에 커진 버퍼는 들고 있지 않는다
+        if (tail_.empty() && tail_.capacity() > kTailKeepBytes) {
+            release_tail();
         }
+        return true;
+    }
+
+    void Session::release_tail() {
+        read_pool_->add_tail_bytes(-static_cast<std::ptrdiff_t>(tail_.capacity()));
+        std::vector<std::uint8_t>().swap(tail_);
+    }
+
+    // route 바이트만 보고 워커로 넘긴다 (verify 는 받는 워커에서 1회)
+    void Session::route_frame(const std::uint8_t* payload, std::uint32_t len) {
+        if (!gameWorker_) return;
+
+        proto::Route        route{};
+        const std::uint8_t* body = nullptr;
+        std::size_t         bodyLen = 0;
+
+        if (!proto::FrameRoute::split(payload, len, route, body, bodyLen)) {
+            LOG_WARN_RATE(10, "[SV] empty frame len={}", len);
+            return;
+        }
+
+        core::NetMessage msg;
+        msg.session = handle_;
+
+        switch (route) {
+        case proto::Route::Game: {
+            msg.type = core::MessageType::NetEnvelope;
+            msg.payload.assign(body, body + bodyLen);
+
+            // 필드 안 게임플레이 패킷은 union 타입 바이트만 엿보고 필드 워커로 (verify 는 필드 워커에서 1회)
+            std::uint8_t pkt = 0;
+            if (fieldRoutes_.load() != 0 && state() == SessionState::InField
+                && proto::PeekRootByte(body, bodyLen, game::Envelope::VT_PKT_TYPE, pkt)
+                && routes_to_field(static_cast<game::Packet>(pkt))) {
+                push_to_field(std::move(msg));
+                break;
+            }
+            gameWorker_->push(std::move(msg));
+            break;
+        }
+
+        case proto::Route::Field:
+            if (state() != SessionState::InField) {
+                LOG_WARN_RATE(10, "[SV] Field frame before EnterField len={}", len);
+                return;
+            }
+            msg.type = core::MessageType::Custom;
+            msg.payload.assign(body, body + bodyLen);
+            push_to_field(std::move(msg));
+            break;
+
+        default:
+            LOG_WARN_RATE(10, "[SV] Unknown route={} len={}", static_cast<int>(route), len);
+            break;
+        }
+    }
+
+    // 입장 때 걸어 둔 필드 워커로 바로 (없으면 필드 ID 로 찾는다)
+    void Session::push_to_field(core::NetMessage&& msg) {
+        if (core::Worker* fw = field_worker()) {
+            fw->push(std::move(msg));
+            return;
+        }
+        core::SendToFieldWorker(field_id(), std::move(msg));
     }
 
     void Session::on_closed() {
+        release_tail();
+        clear_field_routes();
+
+        // 필드에 있던 세션이면 필드 워커가 자기 스레드에서 플레이어를 빼도록 알린다
+        if (state() == SessionState::InField) {
+            core::NetMessage msg;
+            msg.type = core::MessageType::LeaveField;
+            msg.session = handle_;
+            msg.cmd = core::PlayerRefData{ player_id() };
+            push_to_field(std::move(msg));
+        }
+
         if (on_close_) {
             on_close_(shared_from_this());
         }
     }
 
-    void Session::send_payload(const std::uint8_t* payload, std::uint32_t len) {
-        if (closing_) return;
+    void Session::apply_net_config(const config::NetConfig& cfg) {
+        max_write_bytes_ = cfg.max_write_bytes;
+        send_high_water_ = cfg.send_high_water_bytes;
+        send_hard_limit_ = cfg.send_hard_limit_bytes;
+    }
+
+    std::size_t Session::pending_send_bytes() {
+        std::lock_guard<std::mutex> lock(send_mtx_);
+        return queued_bytes_ + inflight_bytes_.load(std::memory_order_relaxed);
+    }
+
+    SharedPacket MakeSharedPacket(const std::uint8_t* payload, std::uint32_t len) {
+        if (!payload || len == 0) return nullptr;
+
+        auto buf = std::make_shared<std::vector<std::uint8_t>>();
+        proto::Frame::write(*buf, payload, len);
+        return buf;
+    }
+
+    void Session::send_payload(const std::uint8_t* payload, std::uint32_t len,
+        SendClass cls, std::uint64_t key) {
+        if (closing_ || kick_) return;
         if (!payload || len == 0) return;
 
         PendingSend ps;
         proto::Frame::write(ps.buf, payload, len);
 
+        auto& stats = send_stats();
+        stats.frame_allocs.fetch_add(1, std::memory_order_relaxed);
+        stats.frame_copy_bytes.fetch_add(ps.buf.size(), std::memory_order_relaxed);
+
+        enqueue_send(std::move(ps), cls, key);
+    }
+
+    void Session::send_shared(const SharedPacket& pkt, SendClass cls, std::uint64_t key) {
+        if (closing_ || kick_) return;
+        if (!pkt || pkt->empty()) return;
+
+        PendingSend ps;
+        ps.shared = pkt;
+        send_stats().shared_sends.fetch_add(1, std::memory_order_relaxed);
+
+        enqueue_send(std::move(ps), cls, key);
+    }
+
+    void Session::enqueue_send(PendingSend&& ps, SendClass cls, std::uint64_t key) {
+        ps.cls = cls;
+
+        auto& stats = send_stats();
+        bool kick = false;
+
         {
             std::lock_guard<std::mutex> lock(send_mtx_);
-            send_q_.push_back(std::move(ps));
+
+            const std::size_t pending =
+                queued_bytes_ + inflight_bytes_.load(std::memory_order_relaxed);
+
+            // 하드 리밋: 더 쌓지 않고 세션을 끊는다
+            if (pending + ps.size() > send_hard_limit_) {
+                kick = true;
+            }
+            else if (cls == SendClass::Reliable) {
+                if (key != 0) {
+                    latest_move_.erase(key);
+                    latest_stat_.erase(key);
+                }
+                queued_bytes_ += ps.size();
+                send_q_.push_back(std::move(ps));
+            }
+            else {
+                auto& latest = (cls == SendClass::Move) ? latest_move_ : latest_stat_;
+
+                // 수위 초과: 아직 안 나간 같은 엔티티의 이전 갱신을 최신 값으로 덮어쓴다
+                if (pending > send_high_water_) {
+                    auto it = latest.find(key);
+                    if (it != latest.end()) {
+                        auto& old = send_q_[it->second];
+                        queued_bytes_ -= old.size();
+                        queued_bytes_ += ps.size();
+                        old = std::move(ps);
+
+                        if (cls == SendClass::Move)
+                            stats.collapsed_move.fetch_add(1, std::memory_order_relaxed);
+                        else
+                            stats.collapsed_stat.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+
+                latest[key] = send_q_.size();
+                queued_bytes_ += ps.size();
+                send_q_.push_back(std::move(ps));
+            }
+        }
+
+        if (kick) {
+            if (!kick_.exchange(true)) {
+                stats.hard_limit_kicks.fetch_add(1, std::memory_order_relaxed);
+                LOG_WARN("[SV] send hard limit exceeded, kick session={}", id_);
+            }
         }
 
         uv_async_send(&send_async_);
@@ -158,6 +352,11 @@ namespace net {
     void Session::on_send_async(uv_async_t* h) {
         auto* self = reinterpret_cast<Session*>(h->data);
         if (!self || self->closing_) return;
+
+        if (self->kick_) {
+            self->close();
+            return;
+        }
         self->flush_send_queue();
     }
 
@@ -168,61 +367,106 @@ namespace net {
         {
             std::lock_guard<std::mutex> lock(send_mtx_);
             local.swap(send_q_);
+            latest_move_.clear();
+            latest_stat_.clear();
+
+            // 큐에서 꺼낸 만큼은 libuv 쪽(inflight)으로 넘어간다
+            inflight_bytes_.fetch_add(queued_bytes_, std::memory_order_relaxed);
+            queued_bytes_ = 0;
         }
 
-        for (auto& ps : local) {
-            auto* wr = new WriteReq{};
-            wr->buf = std::move(ps.buf);
-            wr->req.data = wr;
+        auto& stats = send_stats();
 
-            uv_buf_t b = uv_buf_init(
-                reinterpret_cast<char*>(wr->buf.data()),
-                static_cast<unsigned>(wr->buf.size())
-            );
+        while (!local.empty()) {
+            WriteReq* wr = acquire_write_req();
+
+            // max_write_bytes_ 까지 모은다 (프레임 하나가 더 커도 최소 1개는 보냄)
+            std::size_t bytes = 0;
+            while (!local.empty()) {
+                auto& ps = local.front();
+                if (!wr->frames.empty() && bytes + ps.size() > max_write_bytes_)
+                    break;
+
+                bytes += ps.size();
+                wr->frames.push_back(std::move(ps));
+                local.pop_front();
+            }
+
+            for (auto& ps : wr->frames) {
+                // 공유 패킷도 libuv 는 읽기만 한다
+                wr->bufs.push_back(uv_buf_init(
+                    reinterpret_cast<char*>(const_cast<std::uint8_t*>(ps.data())),
+                    static_cast<unsigned>(ps.size())
+                ));
+            }
+
+            const std::size_t frameCount = wr->frames.size();
+            wr->bytes = bytes;
 
             int r = uv_write(
                 &wr->req,
                 stream(),
-                &b,
-                1,
-                [](uv_write_t* req, int status) {
-                    auto* w = reinterpret_cast<WriteReq*>(req->data);
-
-                    delete w;
-                }
+                wr->bufs.data(),
+                static_cast<unsigned>(wr->bufs.size()),
+                &Session::write_cb
             );
 
             if (r < 0) {
-     
-                delete wr;
-
+                release_write_req(wr);
+                break;
             }
+
+            stats.writes.fetch_add(1, std::memory_order_relaxed);
+            stats.frames.fetch_add(frameCount, std::memory_order_relaxed);
+            stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
         }
+
+        // uv_write 실패로 못 보낸 나머지는 버린다
+        std::size_t dropped = 0;
+        for (auto& ps : local) dropped += ps.size();
+        if (dropped) inflight_bytes_.fetch_sub(dropped, std::memory_order_relaxed);
     }
 
+    void Session::write_cb(uv_write_t* req, int status) {
+        (void)status;
+        auto* wr = reinterpret_cast<WriteReq*>(req->data);
+        wr->owner->release_write_req(wr);
+    }
 
-    bool IsEnvelope(const uint8_t* data, size_t len)
-    {
-        flatbuffers::Verifier v(data, len);
-        return v.VerifyBuffer<game::Envelope>(nullptr);
+    Session::WriteReq* Session::acquire_write_req() {
+        WriteReq* wr = nullptr;
+        if (!free_write_reqs_.empty()) {
+            wr = free_write_reqs_.back();
+            free_write_reqs_.pop_back();
+        }
+        else {
+            wr = new WriteReq{};
+            wr->owner = this;
+        }
+        wr->req.data = wr;
+        return wr;
     }
 
-    bool IsSkillEnvelope(const uint8_t* data, size_t len)
-    {
-        flatbuffers::Verifier v(data, len);
-        if (!v.VerifyBuffer<game::Envelope>(nullptr))
-            return false;
+    void Session::release_write_req(WriteReq* wr) {
+        inflight_bytes_.fetch_sub(wr->bytes, std::memory_order_relaxed);
+        wr->bytes = 0;
 
-        auto env = flatbuffers::GetRoot<game::Envelope>(data);
-        if (!env) return false;
+        // 버퍼 용량은 남겨 두고 다음 flush 에서 재사용
+        wr->frames.clear();
+        wr->bufs.clear();
+        free_write_reqs_.push_back(wr);
+    }
 
-        return env->pkt_type() == game::Packet_SkillCmd;
+    SendStats& send_stats() {
+        static SendStats stats;
+        return stats;
     }
 
-    bool IsFieldCmd(const uint8_t* data, size_t len)
+
+    bool IsEnvelope(const uint8_t* data, size_t len)
     {
         flatbuffers::Verifier v(data, len);
-        return v.VerifyBuffer<field::FieldCmd>(nullptr);
+        return v.VerifyBuffer<game::Envelope>(nullptr);
     }
 
 } // namespace net
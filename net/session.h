@@ -4,76 +4,184 @@
 #include <vector>
 #include <deque>
 #include <mutex>
+#include <atomic>
 #include <memory>
 #include <functional>
+#include <unordered_map>
 
 #include "worker/codec.h"
 #include "core/dispatcher.h"
 #include "core/ids.h"
+#include "net/read_buffer_pool.h"
+#include "net/session_handle.h"
+#include "config/server_config.h"
 
 namespace core {
-    class Worker;   //  GameWorker Ϳ  
+    class Worker;   // ★ GameWorker 포인터용 전방 선언
+    struct NetMessage;
 }
 
 namespace net {
 
 
     enum class SessionState {
-        Connected,   // Ӹ   (α )
-        LoggedIn,    // α  (ʵ  )
-        InField,     // ʵ ȿ  
+        Connected,   // 접속만 된 상태 (로그인 전)
+        LoggedIn,    // 로그인 성공 (필드 입장 전)
+        InField,     // 필드 안에 들어간 상태
     };
 
+    // 송신 패킷 분류 (송신 수위 초과 시 처리 방식)
+    //  - Reliable : Enter/Leave/Combat/Ack 등, 항상 순서대로 보낸다
+    //  - Move     : 같은 엔티티의 위치 갱신, 최신 것만 의미 있음
+    //  - Stat     : 같은 엔티티의 HP/SP 스냅샷, 최신 것만 의미 있음
+    enum class SendClass : std::uint8_t {
+        Reliable = 0,
+        Move = 1,
+        Stat = 2,
+    };
+
+    // 송신 통계 (전체 세션 합계)
+    //  - frames / writes = write 한 번에 묶인 프레임 수
+    //  - bytes / writes  = syscall 한 번당 바이트
+    //  - collapsed_*     = 수위 초과로 큐 안의 이전 갱신을 덮어쓴 횟수
+    //  - hard_limit_kicks= 하드 리밋 초과로 끊은 세션 수
+    struct SendStats {
+        std::atomic<std::uint64_t> writes{ 0 };
+        std::atomic<std::uint64_t> frames{ 0 };
+        std::atomic<std::uint64_t> bytes{ 0 };
+
+        std::atomic<std::uint64_t> collapsed_move{ 0 };
+        std::atomic<std::uint64_t> collapsed_stat{ 0 };
+        std::atomic<std::uint64_t> hard_limit_kicks{ 0 };
+
+        // 송신 버퍼 할당/복사 (send_payload 는 세션마다 1회씩, send_shared 는 공유 버퍼 참조만)
+        std::atomic<std::uint64_t> frame_allocs{ 0 };
+        std::atomic<std::uint64_t> frame_copy_bytes{ 0 };
+        std::atomic<std::uint64_t> shared_sends{ 0 };
+
+        // 브로드캐스트 1회 = 인코딩 1회 (watchers 는 받은 세션 수 합계)
+        std::atomic<std::uint64_t> broadcasts{ 0 };
+        std::atomic<std::uint64_t> broadcast_watchers{ 0 };
+    };
+
+    SendStats& send_stats();
+
+    // 한 번 프레이밍해 여러 세션이 같이 보내는 읽기 전용 패킷 (브로드캐스트용)
+    //  - 각 세션 송신 큐에는 참조만 들어가고 libuv 도 이 버퍼에서 바로 write 한다
+    //  - 마지막 write 가 끝나면 해제
+    using SharedPacket = std::shared_ptr<const std::vector<std::uint8_t>>;
+    SharedPacket MakeSharedPacket(const std::uint8_t* payload, std::uint32_t len);
+
     class Session : public std::enable_shared_from_this<Session> {
     public:
         using Ptr = std::shared_ptr<Session>;
         using OnClose = std::function<void(Ptr)>;
-        Session(uv_loop_t* loop, core::Dispatcher* disp);
+        using OnReclaim = std::function<void(Ptr)>;
+        Session(uv_loop_t* loop, core::Dispatcher* disp, ReadBufferPool* readPool);
         ~Session();
 
         void start();
+        void close();   // 세션 루프 스레드에서만 호출
         uv_stream_t* stream();
 
-        void send_payload(const std::uint8_t* payload, std::uint32_t len);
-        // TcpServer ϴ ݹ
+        // key: 대상 엔티티 ID
+        //  - Move/Stat 은 수위 초과 시 큐에 남은 같은 key 의 이전 패킷을 덮어쓴다
+        //  - Reliable 에 key 를 주면 그 엔티티의 이전 Move/Stat 은 더 이상 덮어쓰지 않는다 (Enter/Leave 순서 보존)
+        void send_payload(const std::uint8_t* payload, std::uint32_t len,
+            SendClass cls = SendClass::Reliable, std::uint64_t key = 0);
+        // 이미 프레이밍된 공유 패킷을 복사 없이 큐에 넣는다 (cls/key 의미는 send_payload 와 같음)
+        void send_shared(const SharedPacket& pkt,
+            SendClass cls = SendClass::Reliable, std::uint64_t key = 0);
+        // TcpServer에서 등록하는 콜백
         void set_on_close(OnClose cb) { on_close_ = std::move(cb); }
+        // SessionTable 이 유예를 마친 세션을 넘기는 콜백 (소유 루프로 보내 그 스레드에서 파괴)
+        //  - 없으면 회수한 스레드에서 바로 놓는다
+        void set_on_reclaim(OnReclaim cb) { on_reclaim_ = std::move(cb); }
+        const OnReclaim& on_reclaim() const { return on_reclaim_; }
+
 
+        // 송신 묶음/수위 설정 (config::NetConfig)
+        void apply_net_config(const config::NetConfig& cfg);
 
+        // libuv 에 넘긴 바이트 + 아직 큐에 있는 바이트
+        std::size_t pending_send_bytes();
+
+        // 이 세션 담당 GameWorker 샤드 (accept 때 세션 ID 로 고정)
         void set_game_worker(core::Worker* w) { gameWorker_ = w; }
         // ID / PlayerID
+        //  - player/state/field 는 GameWorker 샤드가 쓰고 I/O 루프·필드 워커가 읽으므로 atomic
         std::uint64_t session_id() const { return id_; }
-        void          set_player_id(std::uint64_t pid) { player_id_ = pid; }
-        std::uint64_t player_id() const { return player_id_; }
+
+        // SessionTable 핸들 (accept 직후 등록, NetMessage 에는 이것만 싣는다)
+        SessionHandle handle() const { return handle_; }
+        void          set_handle(SessionHandle h) { handle_ = h; }
+        void          set_player_id(std::uint64_t pid) { player_id_.store(pid); }
+        std::uint64_t player_id() const { return player_id_.load(); }
 
 
-        void         set_state(SessionState s) { state_ = s; }
-        SessionState state() const { return state_; }
+        // InField 로 바꾸기 전에 set_field_id 를 먼저 부른다 (state 를 본 쪽이 field id 도 보도록)
+        void         set_state(SessionState s) { state_.store(s); }
+        SessionState state() const { return state_.load(); }
 
-        void set_field_id(int fid) { fieldId_ = fid; }
-        int  field_id() const { return fieldId_; }
+        void set_field_id(int fid) { fieldId_.store(fid); }
+        int  field_id() const { return fieldId_.load(); }
+
+        // field_id 필드 워커 메일박스 (set_field_id 전에 같이 건다)
+        //  - I/O 루프가 FieldManager 락/shared_ptr 복사 없이 바로 push. 필드 워커 객체는 FieldManager 가 끝까지 들고 있다
+        void          set_field_worker(core::Worker* w) { fieldWorker_.store(w); }
+        core::Worker* field_worker() const { return fieldWorker_.load(); }
+
+        // 라우트 테이블: InField 일 때 GameWorker 를 거치지 않고 필드 워커로 바로 보낼 game::Packet (비트 = Packet 값)
+        //  - 필드를 떠날 때(다른 필드 입장, 연결 종료) 반드시 비운다
+        static constexpr std::uint32_t RouteBit(game::Packet p) { return 1u << static_cast<std::uint32_t>(p); }
+        void set_field_routes(std::uint32_t mask) { fieldRoutes_.store(mask); }
+        void clear_field_routes() { fieldRoutes_.store(0); }
+        bool routes_to_field(game::Packet p) const {
+            return static_cast<std::uint32_t>(p) < 32 && (fieldRoutes_.load() & RouteBit(p)) != 0;
+        }
+
+        std::size_t tail_capacity() const { return tail_.capacity(); }
 
     private:
-        // -----  ݹ -----
+        // ----- 기존 콜백들 -----
         static void alloc_cb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf);
         static void read_cb(uv_stream_t* s, ssize_t nread, const uv_buf_t* buf);
         static void close_cb(uv_handle_t* handle);
 
         void on_read(ssize_t nread, const uv_buf_t* buf);
         void on_closed();
+        void route_frame(const std::uint8_t* payload, std::uint32_t len);
+        void push_to_field(core::NetMessage&& msg);
+        bool append_tail(const std::uint8_t* data, std::size_t n, std::size_t& used);
+        void release_tail();
 
     private:
 
         struct PendingSend {
             std::vector<std::uint8_t> buf;
+            SharedPacket              shared;   // 있으면 buf 대신 이것을 보낸다
+            SendClass                 cls{ SendClass::Reliable };
+
+            const std::uint8_t* data() const { return shared ? shared->data() : buf.data(); }
+            std::size_t         size() const { return shared ? shared->size() : buf.size(); }
         };
 
+        void enqueue_send(PendingSend&& ps, SendClass cls, std::uint64_t key);
+
+        // 큐에 쌓인 프레임 여러 개를 uv_write 한 번으로 보낸다
         struct WriteReq {
-            uv_write_t req{};
-            std::vector<std::uint8_t> buf;
+            uv_write_t               req{};
+            Session*                 owner{ nullptr };
+            std::vector<PendingSend> frames;
+            std::vector<uv_buf_t>    bufs;
+            std::size_t              bytes{ 0 };
         };
 
         static void on_send_async(uv_async_t* h);
+        static void write_cb(uv_write_t* req, int status);
         void flush_send_queue();
+        WriteReq* acquire_write_req();
+        void release_write_req(WriteReq* wr);
 
     private:
         uv_loop_t* loop_{ nullptr };
@@ -81,33 +189,50 @@ namespace net {
 
         uv_tcp_t client_{};
 
-        std::vector<std::uint8_t> recv_buf_;
-        std::vector<std::uint8_t> scratch_;
+        static constexpr std::size_t kMaxFrameBytes = 64 * 1024;
+        static constexpr std::size_t kTailKeepBytes = 512;   // 이보다 커진 꼬리 버퍼는 프레임 완성 후 반납
+
+        ReadBufferPool*           read_pool_{ nullptr };   // 루프 공유 read slab
+        std::vector<std::uint8_t> tail_;                   // 끝나지 않은 프레임 꼬리만 보관
 
 
         uv_async_t send_async_{};
         std::mutex send_mtx_;
         std::deque<PendingSend> send_q_;
+        std::size_t             queued_bytes_{ 0 };   // send_mtx_ 보호
+        // Move/Stat key -> send_q_ 안의 최신 위치 (flush 때 초기화)
+        std::unordered_map<std::uint64_t, std::size_t> latest_move_;
+        std::unordered_map<std::uint64_t, std::size_t> latest_stat_;
+
+        std::atomic<std::size_t> inflight_bytes_{ 0 };   // uv_write 완료 대기 중
+        std::atomic<bool>        kick_{ false };         // 하드 리밋 초과 -> 루프에서 close
+
+        std::size_t            max_write_bytes_{ 64 * 1024 };
+        std::size_t            send_high_water_{ 256 * 1024 };
+        std::size_t            send_hard_limit_{ 4 * 1024 * 1024 };
+        std::vector<WriteReq*> free_write_reqs_;   // 루프 스레드 전용 재사용 풀
 
 
-        bool closing_{ false };
+        std::atomic<bool> closing_{ false };
 
     private:
         std::uint64_t    id_{ 0 };
-        std::uint64_t    player_id_{ 0 };
+        SessionHandle    handle_{};
+        std::atomic<std::uint64_t> player_id_{ 0 };
 
 
-        SessionState     state_{ SessionState::Connected };
-        int              fieldId_{ 0 };
+        std::atomic<SessionState>  state_{ SessionState::Connected };
+        std::atomic<int>           fieldId_{ 0 };
+        std::atomic<core::Worker*> fieldWorker_{ nullptr };   // GameWorker 가 쓰고 I/O 루프가 읽는다
+        std::atomic<std::uint32_t> fieldRoutes_{ 0 };   // GameWorker 가 쓰고 I/O 루프가 읽는다
 
         OnClose          on_close_;
+        OnReclaim        on_reclaim_;
 
         core::Worker* gameWorker_{ nullptr };
     };
 
     bool IsEnvelope(const uint8_t* data, size_t len);
-    bool IsSkillEnvelope(const uint8_t* data, size_t len);
-    bool IsFieldCmd(const uint8_t* data, size_t len);
 
 } // namespace net
 
@@ -1,93 +1,277 @@
 // net/session_manager.h
 #pragma once
 
+#include <atomic>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "session.h"
+#include "session_table.h"
+#include "session_epoch.h"
+#include "core/log.h"
 
 namespace net {
 
+    // 세션 ID / 플레이어 ID -> 세션 디렉터리
+    //  - 조회가 대부분 (필드 워커들이 AOI 이벤트/브로드캐스트마다 플레이어 -> 세션)
+    //    -> 키 해시로 kShards 개 조각, 조각마다 고정 버킷 체인 해시 (노드 단위 RCU)
+    //    -> 조회는 락/공유 쓰기 없이 버킷 체인을 따라 읽는다
+    //  - 쓰기(접속/종료/로그인)는 조각 락 안에서 노드 하나만 넣고/값을 바꾸고/떼어 낸다 (맵 복사 없음)
+    //    떼어 낸 노드는 SessionEpoch 의 모든 읽기 스레드가 정지점을 지난 뒤 놓는다
+    //  - 조회는 SessionEpoch 에 등록된 스레드에서만 (디버그 빌드는 assert)
+    //  - 값은 SessionHandle 이라 조회에 참조 카운트가 없다
+    //  - 세션 -> 플레이어 역인덱스로 remove_session 이 O(1) (전체 순회 없음)
+    //  - 한 번에 조각 락 하나만 잡는다 (락 순서 문제 없음)
     class SessionManager {
     public:
+        static constexpr std::size_t kShards = 64;
+        static constexpr std::size_t kBuckets = 1024;   // 조각당 버킷 (늘리지 않는다. 6만 세션이면 체인 길이 ~1)
+
         static SessionManager& instance() {
             static SessionManager inst;
             return inst;
         }
 
-        //    
+        // 접속 직후 세션 등록
         void add_session(const Session::Ptr& sess) {
             if (!sess) return;
-            std::lock_guard<std::mutex> lock(mutex_);
-            auto sid = sess->session_id();
-            sessions_by_session_id_[sid] = sess;
+            const std::uint64_t h = mix(sess->session_id());
+            auto& sh = shard(h);
+            std::lock_guard<std::mutex> lock(sh.mutex);
+            put_locked(sh.bySession, h, sess->session_id(), sess->handle());
         }
 
-        //   (  )
+        // 세션 제거 (연결 종료 시)
         void remove_session(std::uint64_t sessionId) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            sessions_by_session_id_.erase(sessionId);
-
-            // playerId ε 
-            for (auto it = sessions_by_player_id_.begin();
-                it != sessions_by_player_id_.end(); )
+            SessionHandle handle{};
+            std::uint64_t playerId = 0;
             {
-                if (auto sp = it->second.lock()) {
-                    if (sp->session_id() == sessionId) {
-                        it = sessions_by_player_id_.erase(it);
-                    }
-                    else {
-                        ++it;
-                    }
-                }
-                else {
-                    it = sessions_by_player_id_.erase(it);
+                const std::uint64_t h = mix(sessionId);
+                auto& sh = shard(h);
+                std::lock_guard<std::mutex> lock(sh.mutex);
+
+                if (!erase_locked(sh, sh.bySession, h, sessionId, &handle)) return;
+
+                auto pit = sh.playerOfSession.find(sessionId);
+                if (pit != sh.playerOfSession.end()) {
+                    playerId = pit->second;
+                    sh.playerOfSession.erase(pit);
                 }
             }
+
+            if (playerId == 0) return;
+
+            // playerId 매핑도 정리 (그 사이 다른 세션으로 다시 묶였으면 두고 간다)
+            const std::uint64_t h = mix(playerId);
+            auto& ph = shard(h);
+            std::lock_guard<std::mutex> lock(ph.mutex);
+            Node* n = find_node(ph.byPlayer, h, playerId);
+            if (n && unpack(n->value.load(std::memory_order_relaxed)) == handle) {
+                erase_locked(ph, ph.byPlayer, h, playerId, nullptr);
+            }
         }
+
         void bind_player(std::uint64_t playerId, const Session::Ptr& sess) {
             if (!sess) return;
-            std::lock_guard<std::mutex> lock(mutex_);
-            sessions_by_player_id_[playerId] = sess;
+            {
+                const std::uint64_t h = mix(playerId);
+                auto& ph = shard(h);
+                std::lock_guard<std::mutex> lock(ph.mutex);
+                put_locked(ph.byPlayer, h, playerId, sess->handle());
+            }
+            auto& sh = shard(mix(sess->session_id()));
+            std::lock_guard<std::mutex> lock(sh.mutex);
+            sh.playerOfSession[sess->session_id()] = playerId;
         }
 
         void unbind_player(std::uint64_t playerId) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            sessions_by_player_id_.erase(playerId);
+            const std::uint64_t h = mix(playerId);
+            auto& ph = shard(h);
+            std::lock_guard<std::mutex> lock(ph.mutex);
+            erase_locked(ph, ph.byPlayer, h, playerId, nullptr);
         }
 
         Session::Ptr find_by_session_id(std::uint64_t sessionId) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            auto it = sessions_by_session_id_.find(sessionId);
-            if (it == sessions_by_session_id_.end())
-                return nullptr;
-            return it->second.lock();
+            const std::uint64_t h = mix(sessionId);
+            Session* s = ResolveSession(lookup(shard(h).bySession, h, sessionId));
+            return s ? s->shared_from_this() : nullptr;
         }
 
         Session::Ptr find_by_player_id(std::uint64_t playerId) {
-            std::lock_guard<std::mutex> lock(mutex_);
-            auto it = sessions_by_player_id_.find(playerId);
-            if (it == sessions_by_player_id_.end())
-                return nullptr;
-
-            auto sp = it->second.lock();
-            if (!sp) {
-                sessions_by_player_id_.erase(it);
+            Session* s = ResolveSession(resolve_player(playerId));
+            return s ? s->shared_from_this() : nullptr;
+        }
+
+        // 핫 패스용: 참조 카운트 없이 핸들만 (닫힌 세션이면 ResolveSession 이 nullptr)
+        SessionHandle resolve_player(std::uint64_t playerId) {
+            const std::uint64_t h = mix(playerId);
+            return lookup(shard(h).byPlayer, h, playerId);
+        }
+
+        // 스레드별 조회 수 합계 (초당). 필드 워커 수를 바꿔가며 조회 처리량 비교
+        void log_stats() {
+            std::uint64_t total = 0;
+            {
+                std::lock_guard<std::mutex> lock(countersMutex_);
+                for (const auto& c : counters_) total += c->lookups.load(std::memory_order_relaxed);
             }
-            return sp;
+
+            const auto now = std::chrono::steady_clock::now();
+            const double sec = std::chrono::duration<double>(now - statsLastTime_).count();
+            const std::uint64_t delta = total - statsLastLookups_;
+            statsLastTime_ = now;
+            statsLastLookups_ = total;
+
+            LOG_INFO("[SessionManager] shards={} lookups={} lookups/s={} live_sessions={} retired_sessions={}",
+                kShards, total, sec > 0.0 ? double(delta) / sec : 0.0,
+                SessionTable::instance().live_count(), SessionTable::instance().retired_count());
         }
 
     private:
         SessionManager() = default;
-        ~SessionManager() = default;
+        ~SessionManager() {
+            for (auto& sh : shards_) {
+                free_all(sh.bySession);
+                free_all(sh.byPlayer);
+                for (auto& r : sh.retired) delete r.node;
+            }
+        }
 
         SessionManager(const SessionManager&) = delete;
         SessionManager& operator=(const SessionManager&) = delete;
 
-        std::mutex mutex_;
-        std::unordered_map<std::uint64_t, std::weak_ptr<Session>> sessions_by_session_id_;
-        std::unordered_map<std::uint64_t, std::weak_ptr<Session>> sessions_by_player_id_;
+        // 값은 (index, gen) 을 64비트 하나로 (읽기 스레드가 한 번에 읽는다)
+        struct Node {
+            std::uint64_t              key{ 0 };
+            std::atomic<std::uint64_t> value{ 0 };
+            std::atomic<Node*>         next{ nullptr };
+        };
+        using Buckets = std::array<std::atomic<Node*>, kBuckets>;
+
+        struct RetiredNode {
+            Node*         node;
+            std::uint64_t epoch;   // 떼어 낼 때 올린 SessionEpoch
+        };
+
+        struct alignas(64) Shard {
+            std::mutex                                        mutex;       // 쓰기 전용
+            Buckets                                           bySession{};
+            Buckets                                           byPlayer{};
+            std::unordered_map<std::uint64_t, std::uint64_t>  playerOfSession;   // 역인덱스 (세션 ID -> 플레이어 ID), mutex 보호
+            std::deque<RetiredNode>                           retired;     // mutex 보호 (epoch 오름차순)
+        };
+
+        // 스레드별 조회 카운터 (공유 캐시 라인에 fetch_add 하지 않는다)
+        struct alignas(64) LookupCounter {
+            std::atomic<std::uint64_t> lookups{ 0 };
+        };
+
+        static std::uint64_t pack(SessionHandle h) {
+            return (static_cast<std::uint64_t>(h.index) << 32) | h.gen;
+        }
+        static SessionHandle unpack(std::uint64_t v) {
+            return SessionHandle{ static_cast<std::uint32_t>(v >> 32), static_cast<std::uint32_t>(v) };
+        }
+
+        // 연속 ID 가 고르게 퍼지도록 섞는다 (아래 6비트 = 조각, 그 위 = 버킷)
+        static std::uint64_t mix(std::uint64_t key) {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            return key;
+        }
+        Shard& shard(std::uint64_t h) { return shards_[h & (kShards - 1)]; }
+        static std::atomic<Node*>& bucket(Buckets& b, std::uint64_t h) { return b[(h >> 6) & (kBuckets - 1)]; }
+
+        static Node* find_node(Buckets& b, std::uint64_t h, std::uint64_t key) {
+            for (Node* n = bucket(b, h).load(std::memory_order_acquire); n; n = n->next.load(std::memory_order_acquire)) {
+                if (n->key == key) return n;
+            }
+            return nullptr;
+        }
+
+        // 있으면 값만 바꾸고, 없으면 노드를 다 채운 뒤 체인 앞에 공개
+        static void put_locked(Buckets& b, std::uint64_t h, std::uint64_t key, SessionHandle v) {
+            if (Node* n = find_node(b, h, key)) {
+                n->value.store(pack(v), std::memory_order_release);
+                return;
+            }
+            auto& head = bucket(b, h);
+            Node* n = new Node();
+            n->key = key;
+            n->value.store(pack(v), std::memory_order_relaxed);
+            n->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            head.store(n, std::memory_order_release);
+        }
+
+        // 체인에서 떼어 내고 회수 대기열로 (읽던 스레드는 떼어 낸 노드의 next 로 계속 따라갈 수 있다)
+        static bool erase_locked(Shard& sh, Buckets& b, std::uint64_t h, std::uint64_t key, SessionHandle* out) {
+            std::atomic<Node*>* link = &bucket(b, h);
+            for (Node* n = link->load(std::memory_order_relaxed); n; n = link->load(std::memory_order_relaxed)) {
+                if (n->key != key) {
+                    link = &n->next;
+                    continue;
+                }
+                if (out) *out = unpack(n->value.load(std::memory_order_relaxed));
+                link->store(n->next.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+
+                sh.retired.push_back(RetiredNode{ n, SessionEpoch::instance().advance() });
+                const std::uint64_t safe = SessionEpoch::instance().safe_epoch();
+                while (!sh.retired.empty() && sh.retired.front().epoch <= safe) {
+                    delete sh.retired.front().node;
+                    sh.retired.pop_front();
+                }
+                return true;
+            }
+            return false;
+        }
+
+        static void free_all(Buckets& b) {
+            for (auto& head : b) {
+                Node* n = head.load(std::memory_order_relaxed);
+                while (n) {
+                    Node* next = n->next.load(std::memory_order_relaxed);
+                    delete n;
+                    n = next;
+                }
+            }
+        }
+
+        SessionHandle lookup(Buckets& b, std::uint64_t h, std::uint64_t key) {
+            // 등록 안 된 스레드는 떼어 낸 노드가 바로 놓일 수 있다
+            assert(SessionEpoch::is_reader() && "SessionManager lookup from a thread not registered with SessionEpoch");
+
+            LookupCounter& c = thread_counter();
+            c.lookups.store(c.lookups.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+            Node* n = find_node(b, h, key);
+            return n ? unpack(n->value.load(std::memory_order_acquire)) : SessionHandle{};
+        }
+
+        LookupCounter& thread_counter() {
+            thread_local LookupCounter* counter = nullptr;
+            if (!counter) {
+                std::lock_guard<std::mutex> lock(countersMutex_);
+                counters_.push_back(std::make_unique<LookupCounter>());
+                counter = counters_.back().get();
+            }
+            return *counter;
+        }
+
+        std::array<Shard, kShards> shards_;
+
+        std::mutex                                  countersMutex_;
+        std::vector<std::unique_ptr<LookupCounter>> counters_;   // 스레드가 끝나도 남겨 둔다 (합계 유지)
+
+        std::chrono::steady_clock::time_point statsLastTime_{ std::chrono::steady_clock::now() };
+        std::uint64_t                         statsLastLookups_{ 0 };
     };
 
 } // namespace net
@@ -0,0 +1,123 @@
+// net/session_epoch.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#include "core/log.h"
+
+namespace net {
+
+    // 세션 객체 회수용 정지점(QSBR) 카운터
+    //  - ResolveSession 으로 raw 포인터를 얻는 스레드(워커 전용 스레드, FieldScheduler 풀 스레드)는
+    //    SessionReader 로 등록하고, 메시지/틱 조각 사이(포인터를 들고 있지 않은 때)마다 quiescent()
+    //  - 잠들기 전 offline(), 깬 뒤 online(): 잠든 스레드는 회수를 막지 않는다
+    //  - SessionTable 은 해제마다 advance() 로 epoch 를 올리고,
+    //    등록된 모든 스레드가 그 epoch 이후 정지점을 지난 뒤(safe_epoch() 이상)에만 객체를 놓는다
+    class SessionEpoch {
+    public:
+        static constexpr std::size_t   kMaxReaders = 256;
+        static constexpr std::uint64_t kOffline = UINT64_MAX;
+
+        static SessionEpoch& instance() {
+            static SessionEpoch inst;
+            return inst;
+        }
+
+        // 해제 1건: 새 epoch (이 값 이상을 본 스레드는 해제 뒤 정지점을 지났다)
+        std::uint64_t advance() {
+            return epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        }
+
+        // 등록 스레드가 모두 지난 가장 작은 epoch (없거나 모두 잠들었으면 kOffline)
+        std::uint64_t safe_epoch() const {
+            std::uint64_t safe = kOffline;
+            const std::size_t n = highWater_.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < n; ++i) {
+                if (!readers_[i].used.load(std::memory_order_seq_cst)) continue;
+                const std::uint64_t seen = readers_[i].seen.load(std::memory_order_seq_cst);
+                if (seen < safe) safe = seen;
+            }
+            return safe;
+        }
+
+        // 현재 스레드 (등록 안 된 스레드면 아무것도 안 함)
+        static void quiescent() {
+            if (!t_seen) return;
+            t_seen->store(instance().epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        static void offline() {
+            if (t_seen) t_seen->store(kOffline, std::memory_order_seq_cst);
+        }
+        static void online() { quiescent(); }
+        // 현재 스레드가 등록된 읽기 스레드인가 (조회 전 확인용)
+        static bool is_reader() { return t_seen != nullptr; }
+
+        // 이미 등록된 스레드면 false
+        //  - 칸이 없으면 중단: 등록 못 한 스레드의 조회는 회수된 세션을 볼 수 있다 (kMaxReaders 를 늘릴 것)
+        bool attach_current() {
+            if (t_seen) return false;
+            for (std::size_t i = 0; i < kMaxReaders; ++i) {
+                bool expected = false;
+                if (!readers_[i].used.compare_exchange_strong(expected, true)) continue;
+
+                std::size_t hw = highWater_.load(std::memory_order_relaxed);
+                while (hw < i + 1 && !highWater_.compare_exchange_weak(hw, i + 1)) {}
+
+                t_seen = &readers_[i].seen;
+                quiescent();
+                return true;
+            }
+
+            LOG_ERROR("[SessionEpoch] reader slots exhausted (max={}), raise kMaxReaders", kMaxReaders);
+            core::Logger::instance().stop();   // 중단 전에 남은 로그를 쓴다
+            std::abort();
+        }
+
+        void detach_current() {
+            if (!t_seen) return;
+            for (auto& r : readers_) {
+                if (&r.seen != t_seen) continue;
+                r.seen.store(kOffline, std::memory_order_seq_cst);
+                r.used.store(false, std::memory_order_seq_cst);
+                break;
+            }
+            t_seen = nullptr;
+        }
+
+    private:
+        SessionEpoch() = default;
+
+        SessionEpoch(const SessionEpoch&) = delete;
+        SessionEpoch& operator=(const SessionEpoch&) = delete;
+
+        struct alignas(64) Reader {
+            std::atomic<std::uint64_t> seen{ kOffline };
+            std::atomic<bool>          used{ false };
+        };
+
+        static inline thread_local std::atomic<std::uint64_t>* t_seen = nullptr;
+
+        std::atomic<std::uint64_t>     epoch_{ 1 };
+        std::array<Reader, kMaxReaders> readers_;
+        std::atomic<std::size_t>       highWater_{ 0 };
+    };
+
+    // 스레드가 도는 동안 등록 (워커 루프 / 풀 스레드 / stop 중 마지막 처리)
+    class SessionReader {
+    public:
+        SessionReader() : attached_(SessionEpoch::instance().attach_current()) {}
+        ~SessionReader() { if (attached_) SessionEpoch::instance().detach_current(); }
+
+        SessionReader(const SessionReader&) = delete;
+        SessionReader& operator=(const SessionReader&) = delete;
+
+    private:
+        bool attached_;
+    };
+
+} // namespace net
@@ -0,0 +1,23 @@
+// net/session_handle.h
+#pragma once
+
+#include <cstdint>
+
+namespace net {
+
+    // 세션 테이블 칸 번호 + 세대 (NetMessage 에 shared_ptr 대신 싣는다)
+    //  - 복사해도 참조 카운트가 움직이지 않는다
+    //  - 세션이 닫히면 세대가 바뀌어 옛 핸들은 resolve 가 nullptr (보내기는 그냥 무시)
+    //  - gen == 0 은 빈 핸들
+    struct SessionHandle {
+        std::uint32_t index{ 0 };
+        std::uint32_t gen{ 0 };
+
+        bool valid() const { return gen != 0; }
+        explicit operator bool() const { return valid(); }
+
+        bool operator==(const SessionHandle& o) const { return index == o.index && gen == o.gen; }
+        bool operator!=(const SessionHandle& o) const { return !(*this == o); }
+    };
+
+} // namespace net
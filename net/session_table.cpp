@@ -0,0 +1,104 @@
+// net/session_table.cpp
+#include "session_table.h"
+
+namespace net {
+
+    SessionTable::~SessionTable() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        retired_.clear();
+        for (auto& chunk : owned_) {
+            for (std::uint32_t i = 0; i < kChunkSize; ++i) chunk[i].owner.reset();
+        }
+    }
+
+    SessionTable::Slot& SessionTable::slot_locked(std::uint32_t index) {
+        return chunks_[index >> kChunkBits].load(std::memory_order_relaxed)[index & (kChunkSize - 1)];
+    }
+
+    // 모든 읽기 스레드가 해제 뒤 정지점을 지난 세션을 꺼내고 칸을 재사용 목록에 돌린다
+    void SessionTable::reclaim_locked(std::vector<Session::Ptr>& dead) {
+        if (retired_.empty()) return;
+
+        const std::uint64_t safe = SessionEpoch::instance().safe_epoch();
+        while (!retired_.empty() && retired_.front().epoch <= safe) {
+            Retired& r = retired_.front();
+            slot_locked(r.index).raw.store(nullptr, std::memory_order_relaxed);
+            free_.push_back(r.index);
+            dead.push_back(std::move(r.owner));
+            retired_.pop_front();
+        }
+        retiredCount_.store(retired_.size(), std::memory_order_relaxed);
+    }
+
+    // add/remove 는 어느 I/O 루프에서나 불리므로, 세션(uv 핸들 포함)은 자기 루프로 돌려보내 거기서 파괴한다
+    void SessionTable::release(std::vector<Session::Ptr>& dead) {
+        for (auto& sess : dead) {
+            const Session::OnReclaim hook = sess->on_reclaim();
+            if (hook) hook(std::move(sess));
+        }
+        dead.clear();
+    }
+
+    SessionHandle SessionTable::add(const Session::Ptr& sess) {
+        if (!sess) return {};
+
+        std::vector<Session::Ptr> dead;
+        SessionHandle h = add_locked(sess, dead);
+        release(dead);
+        return h;
+    }
+
+    SessionHandle SessionTable::add_locked(const Session::Ptr& sess, std::vector<Session::Ptr>& dead) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reclaim_locked(dead);
+
+        std::uint32_t index = 0;
+        if (!free_.empty()) {
+            index = free_.back();
+            free_.pop_back();
+        }
+        else {
+            if ((nextIndex_ >> kChunkBits) >= kMaxChunks) return {};
+
+            if ((nextIndex_ & (kChunkSize - 1)) == 0) {
+                owned_.push_back(std::make_unique<Slot[]>(kChunkSize));
+                chunks_[nextIndex_ >> kChunkBits].store(owned_.back().get(), std::memory_order_release);
+            }
+            index = nextIndex_++;
+        }
+
+        Slot& slot = slot_locked(index);
+        const std::uint32_t gen = slot.nextGen;
+        slot.nextGen = (gen == UINT32_MAX) ? 1 : gen + 1;   // 0 은 건너뛴다
+
+        slot.owner = sess;
+        slot.raw.store(sess.get(), std::memory_order_relaxed);
+        slot.gen.store(gen, std::memory_order_release);   // raw 를 공개
+
+        live_.fetch_add(1, std::memory_order_relaxed);
+        return SessionHandle{ index, gen };
+    }
+
+    void SessionTable::remove(SessionHandle h) {
+        if (!h.valid()) return;
+
+        std::vector<Session::Ptr> dead;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if ((h.index >> kChunkBits) >= kMaxChunks || h.index >= nextIndex_) return;
+
+            Slot& slot = slot_locked(h.index);
+            if (slot.gen.load(std::memory_order_relaxed) != h.gen) return;
+
+            // 세대를 먼저 지워 새 resolve 를 막고, 객체는 읽기 스레드들이 정지점을 지날 때까지 살려 둔다
+            slot.gen.store(0, std::memory_order_seq_cst);
+            const std::uint64_t epoch = SessionEpoch::instance().advance();
+            retired_.push_back(Retired{ h.index, std::move(slot.owner), epoch });
+            reclaim_locked(dead);
+
+            live_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        release(dead);
+    }
+
+} // namespace net
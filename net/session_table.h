@@ -0,0 +1,98 @@
+// net/session_table.h
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "net/session.h"
+#include "net/session_handle.h"
+#include "net/session_epoch.h"
+
+namespace net {
+
+    // SessionHandle -> Session* 테이블
+    //  - 등록/해제는 I/O 루프에서 (accept / close), resolve 는 어느 워커에서나 락 없이
+    //  - 세션 객체는 이 테이블이 소유한다. 해제 후에는 SessionEpoch 에 등록된 모든 스레드가
+    //    정지점을 지날 때까지 객체와 칸을 그대로 두므로, 해제 직전에 resolve 한 포인터는
+    //    그 메시지/틱 조각을 처리하는 동안 안전하다
+    //    (resolve 는 등록된 스레드에서만, 포인터를 조각 밖으로 들고 나가지 말 것)
+    //  - 칸 배열은 청크 단위로만 늘어나고 옮겨지지 않는다
+    class SessionTable {
+    public:
+        static constexpr std::uint32_t kChunkBits = 12;   // 청크당 4096 칸
+        static constexpr std::uint32_t kChunkSize = 1u << kChunkBits;
+        static constexpr std::uint32_t kMaxChunks = 256;  // 최대 약 100만 동시 세션
+
+        static SessionTable& instance() {
+            static SessionTable inst;
+            return inst;
+        }
+
+        // 실패(가득 참) 시 빈 핸들
+        SessionHandle add(const Session::Ptr& sess);
+        void remove(SessionHandle h);
+
+        // 닫혔거나 재사용된 핸들이면 nullptr
+        Session* resolve(SessionHandle h) const {
+            assert(SessionEpoch::is_reader() && "SessionTable resolve from a thread not registered with SessionEpoch");
+            if (!h.valid() || (h.index >> kChunkBits) >= kMaxChunks) return nullptr;
+
+            Slot* chunk = chunks_[h.index >> kChunkBits].load(std::memory_order_acquire);
+            if (!chunk) return nullptr;
+
+            const Slot& slot = chunk[h.index & (kChunkSize - 1)];
+            if (slot.gen.load(std::memory_order_acquire) != h.gen) return nullptr;
+            return slot.raw.load(std::memory_order_relaxed);
+        }
+
+        std::size_t live_count() const { return live_.load(std::memory_order_relaxed); }
+        std::size_t retired_count() const { return retiredCount_.load(std::memory_order_relaxed); }
+
+    private:
+        SessionTable() = default;
+        ~SessionTable();
+
+        SessionTable(const SessionTable&) = delete;
+        SessionTable& operator=(const SessionTable&) = delete;
+
+        struct Slot {
+            std::atomic<std::uint32_t> gen{ 0 };        // 0 = 비어 있음
+            std::atomic<Session*>      raw{ nullptr };
+            Session::Ptr               owner;           // mutex_ 보호
+            std::uint32_t              nextGen{ 1 };    // mutex_ 보호
+        };
+
+        struct Retired {
+            std::uint32_t index;
+            Session::Ptr  owner;
+            std::uint64_t epoch;   // 해제 때 올린 SessionEpoch
+        };
+
+        SessionHandle add_locked(const Session::Ptr& sess, std::vector<Session::Ptr>& dead);
+        Slot& slot_locked(std::uint32_t index);
+        // 유예가 끝난 세션을 dead 로 옮긴다 (파괴는 락 밖에서 release 로)
+        void reclaim_locked(std::vector<Session::Ptr>& dead);
+        static void release(std::vector<Session::Ptr>& dead);
+
+        std::array<std::atomic<Slot*>, kMaxChunks> chunks_{};
+        std::vector<std::unique_ptr<Slot[]>>       owned_;     // mutex_ 보호
+        std::vector<std::uint32_t>                 free_;      // mutex_ 보호
+        std::deque<Retired>                        retired_;   // mutex_ 보호 (epoch 오름차순)
+        std::uint32_t                              nextIndex_{ 0 };
+        std::atomic<std::size_t>                   live_{ 0 };
+        std::atomic<std::size_t>                   retiredCount_{ 0 };
+        std::mutex                                 mutex_;
+    };
+
+    // NetMessage::session 등 핸들을 현재 세션으로 (없으면 nullptr)
+    inline Session* ResolveSession(SessionHandle h) {
+        return SessionTable::instance().resolve(h);
+    }
+
+} // namespace net
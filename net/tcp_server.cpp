@@ -2,75 +2,318 @@
 #include "net/tcp_server.h"
 #include "net/uv_utils.h"
 #include "net/sessionManager.h"
+#include "net/session_table.h"
 #include "core/Dispatcher.h"
+#include "worker/worker.h"
+#include "core/log.h"
 
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#endif
 
 namespace net {
 
+    namespace {
+
+#if !defined(_WIN32) && defined(SO_REUSEPORT)
+        constexpr bool kReusePortSupported = true;
+#else
+        constexpr bool kReusePortSupported = false;
+#endif
+
+        // 같은 ip:port 에 루프별 리스너를 여러 개 묶어 커널이 accept 를 분산하게 한다
+        int enable_reuse_port(uv_tcp_t* tcp) {
+#if !defined(_WIN32) && defined(SO_REUSEPORT)
+            uv_os_fd_t fd;
+            int r = uv_fileno(reinterpret_cast<uv_handle_t*>(tcp), &fd);
+            if (r < 0) return r;
+
+            int on = 1;
+            if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) != 0)
+                return UV_EINVAL;
+            return 0;
+#else
+            (void)tcp;
+            return UV_ENOTSUP;
+#endif
+        }
+
+    } // namespace
+
     TcpServer::TcpServer(uv_loop_t* loop,
         const char* ip,
         int port,
         core::Dispatcher* disp,
-        core::Worker* gameWorker) 
-        : loop_(loop)
-        , ip_(ip)
+        core::Worker* gameWorker,
+        const config::NetConfig& net)
+        : ip_(ip)
         , port_(port)
         , dispatcher_(disp)
-        , gameWorker_(gameWorker)       
+        , gameWorker_(gameWorker)
+        , net_(net)
     {
-        uv_tcp_init(loop_, &server_);
-        server_.data = this;
+        int count = std::max(1, net_.io_threads);
+        if (count > 1 && !kReusePortSupported) {
+            LOG_WARN("[TcpServer] SO_REUSEPORT not supported, io_threads {} -> 1", count);
+            count = 1;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            auto io = std::make_unique<IoLoop>();
+            io->server = this;
+            io->index = i;
+
+            if (i == 0) {
+                io->loop = loop;
+            }
+            else {
+                io->owned = std::make_unique<uv_loop_t>();
+                net::uv_check(uv_loop_init(io->owned.get()), "uv_loop_init");
+                io->loop = io->owned.get();
+
+                io->stop_async.data = io.get();
+                uv_async_init(io->loop, &io->stop_async, &TcpServer::on_stop_async);
+            }
+
+            io->reap_async.data = io.get();
+            uv_async_init(io->loop, &io->reap_async, &TcpServer::on_reap_async);
+            io->reapOpen = true;
+
+            loops_.push_back(std::move(io));
+        }
+    }
+
+    TcpServer::~TcpServer() {
+        stop();
     }
 
     void TcpServer::start() {
+        if (started_ || stopped_) return;
+        started_ = true;
+
+        for (auto& io : loops_) {
+            listen_on(*io);
+        }
+
+        // 0번 루프는 호출자가 돌리고, 나머지는 루프마다 전용 스레드
+        const int n = static_cast<int>(loops_.size());
+        for (auto& io : loops_) {
+            if (io->index == 0) {
+                core::PinCurrentThread(cores_.pick(0, n));
+                continue;
+            }
+
+            uv_loop_t* l = io->loop;
+            io->thread = std::thread([l] {
+                uv_run(l, UV_RUN_DEFAULT);
+                });
+            core::PinThread(io->thread.native_handle(), cores_.pick(io->index, n));
+        }
+
+        LOG_INFO("[TcpServer] listening {}:{} io_loops={}", ip_, port_, loops_.size());
+    }
+
+    void TcpServer::stop() {
+        if (stopped_) return;
+        stopped_ = true;
+        started_ = false;
+
+        for (auto& io : loops_) {
+            if (io->index == 0) {
+                close_loop(*io);   // 0번 루프는 호출자가 돌린다
+                continue;
+            }
+
+            if (io->thread.joinable()) {
+                uv_async_send(&io->stop_async);
+                continue;
+            }
+
+            // 도는 스레드가 없다 (start 전/도중 실패): 여기서 직접 닫고 close 콜백을 흘려보낸다
+            close_loop(*io);
+            uv_close(reinterpret_cast<uv_handle_t*>(&io->stop_async), nullptr);
+            uv_run(io->loop, UV_RUN_DEFAULT);
+        }
+
+        for (auto& io : loops_) {
+            if (io->thread.joinable()) {
+                io->thread.join();
+            }
+            if (io->owned) {
+                uv_loop_close(io->owned.get());
+            }
+        }
+    }
+
+    void TcpServer::listen_on(IoLoop& io) {
         sockaddr_in addr{};
         net::uv_check(uv_ip4_addr(ip_, port_, &addr), "uv_ip4_addr");
+
+        // SO_REUSEPORT 는 bind 전에 걸어야 하므로 소켓을 먼저 생성한다
+        net::uv_check(uv_tcp_init_ex(io.loop, &io.listener, AF_INET), "uv_tcp_init_ex");
+        io.listener.data = &io;
+        io.listening = true;
+
+        if (loops_.size() > 1) {
+            net::uv_check(enable_reuse_port(&io.listener), "SO_REUSEPORT");
+        }
+
         net::uv_check(
-            uv_tcp_bind(&server_, reinterpret_cast<const sockaddr*>(&addr), 0),
+            uv_tcp_bind(&io.listener, reinterpret_cast<const sockaddr*>(&addr), 0),
             "uv_tcp_bind");
         net::uv_check(
-            uv_listen(reinterpret_cast<uv_stream_t*>(&server_), 128, &TcpServer::on_new_conn),
+            uv_listen(reinterpret_cast<uv_stream_t*>(&io.listener), net_.listen_backlog, &TcpServer::on_new_conn),
             "uv_listen");
     }
 
+    void TcpServer::on_stop_async(uv_async_t* h) {
+        auto* io = reinterpret_cast<IoLoop*>(h->data);
+        io->server->close_loop(*io);
+        uv_close(reinterpret_cast<uv_handle_t*>(&io->stop_async), nullptr);
+    }
+
+    // 루프 스레드에서만 호출: 리스너와 세션 핸들을 모두 닫아 uv_run 이 빠져나오게 한다
+    void TcpServer::close_loop(IoLoop& io) {
+        auto* h = reinterpret_cast<uv_handle_t*>(&io.listener);
+        if (io.listening && !uv_is_closing(h)) {
+            uv_close(h, nullptr);
+        }
+
+        auto sessions = io.sessions;
+        for (auto& sess : sessions) {
+            sess->close();
+        }
+
+        // 이후 회수되는 세션은 회수한 스레드에서 바로 놓는다 (루프가 곧 끝난다)
+        std::vector<Session::Ptr> reaped;
+        {
+            std::lock_guard<std::mutex> lock(io.reapMutex);
+            if (!io.reapOpen) return;
+            io.reapOpen = false;
+            reaped.swap(io.reaped);
+        }
+        uv_close(reinterpret_cast<uv_handle_t*>(&io.reap_async), nullptr);
+    }
+
+    // SessionTable 회수 콜백 (아무 스레드): 소유 루프로 넘긴다
+    void TcpServer::reclaim_on_loop(IoLoop& io, Session::Ptr sess) {
+        std::lock_guard<std::mutex> lock(io.reapMutex);
+        if (!io.reapOpen) return;   // 닫힌 루프: sess 는 여기서 놓인다
+        io.reaped.push_back(std::move(sess));
+        uv_async_send(&io.reap_async);   // 락 안에서: close_loop 가 핸들을 닫는 것과 겹치지 않게
+    }
+
+    void TcpServer::on_reap_async(uv_async_t* h) {
+        auto* io = reinterpret_cast<IoLoop*>(h->data);
+        std::vector<Session::Ptr> reaped;
+        {
+            std::lock_guard<std::mutex> lock(io->reapMutex);
+            reaped.swap(io->reaped);
+        }
+        // 여기(세션의 루프 스레드)서 세션 객체 파괴
+    }
+
     void TcpServer::on_new_conn(uv_stream_t* s, int status) {
-        auto* self = reinterpret_cast<TcpServer*>(s->data);
+        auto* io = reinterpret_cast<IoLoop*>(s->data);
+        auto* self = io->server;
         if (status < 0) {
 
             return;
         }
 
-        auto sess = std::make_shared<Session>(self->loop_, self->dispatcher_);
+        // 세션은 accept 한 루프에 고정 (read/write/async 모두 이 루프에서 처리)
+        auto sess = std::make_shared<Session>(io->loop, self->dispatcher_, &io->read_pool);
 
 
-        if (self->gameWorker_) {
-            sess->set_game_worker(self->gameWorker_);
+        // 샤드가 있으면 세션 ID 로 고른다 (같은 세션 패킷은 항상 같은 샤드 -> 순서 유지)
+        core::Worker* gameWorker = core::GameWorkerFor(sess->session_id());
+        if (!gameWorker) gameWorker = self->gameWorker_;
+        if (gameWorker) {
+            sess->set_game_worker(gameWorker);
         }
+        sess->apply_net_config(self->net_);
 
 
-        sess->set_on_close([self](Session::Ptr closed) {
+        sess->set_on_close([self, io](Session::Ptr closed) {
             SessionManager::instance().remove_session(closed->session_id());
-            self->on_session_closed(closed);
+            // 이후 이 세션 핸들로 온 메시지는 resolve 가 nullptr (객체는 유예 후 해제)
+            SessionTable::instance().remove(closed->handle());
+            self->on_session_closed(*io, closed);
+            });
+        sess->set_on_reclaim([io](Session::Ptr dead) {
+            reclaim_on_loop(*io, std::move(dead));
             });
 
         if (uv_accept(s, sess->stream()) == 0) {
+            sess->set_handle(SessionTable::instance().add(sess));
             sess->start();
 
-            sess->set_player_id(4);
-
+            // player_id 는 로그인(OnRecv_Login)에서 정한다. 그 전에는 0 (필드/스킬 처리가 모두 거절)
             SessionManager::instance().add_session(sess);
-            self->sessions_.push_back(sess);
+            io->sessions.push_back(sess);
+            io->connections.fetch_add(1, std::memory_order_relaxed);
         }
         else {
-     
+
         }
     }
 
-    void TcpServer::on_session_closed(const Session::Ptr& sess) {
-        auto it = std::find(sessions_.begin(), sessions_.end(), sess);
-        if (it != sessions_.end()) {
-            sessions_.erase(it);
+    void TcpServer::on_session_closed(IoLoop& io, const Session::Ptr& sess) {
+        auto it = std::find(io.sessions.begin(), io.sessions.end(), sess);
+        if (it != io.sessions.end()) {
+            io.sessions.erase(it);
+            io.connections.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    void TcpServer::log_memory_stats() const {
+        std::size_t totalConn = 0;
+        std::size_t totalBuf = 0;
+
+        for (const auto& io : loops_) {
+            const std::size_t conn = io->connections.load(std::memory_order_relaxed);
+            const std::size_t slab = io->read_pool.slab_bytes();
+            const std::size_t tail = io->read_pool.tail_bytes();
+
+            LOG_INFO("[TcpServer] loop={} conn={} slabs={} ({}B, in_use={}) tail={}B",
+                io->index, conn, io->read_pool.slab_count(), slab, io->read_pool.slabs_in_use(), tail);
+
+            totalConn += conn;
+            totalBuf += slab + tail;
         }
+
+        const std::size_t perConn = totalConn
+            ? sizeof(Session) + totalBuf / totalConn
+            : sizeof(Session);
+
+        LOG_INFO("[TcpServer] conn={} recv_buffer={}B bytes/conn={}", totalConn, totalBuf, perConn);
+    }
+
+    void TcpServer::log_send_stats() const {
+        const auto& st = send_stats();
+        const std::uint64_t writes = st.writes.load(std::memory_order_relaxed);
+        const std::uint64_t frames = st.frames.load(std::memory_order_relaxed);
+        const std::uint64_t bytes = st.bytes.load(std::memory_order_relaxed);
+
+        LOG_INFO("[TcpServer] writes={} frames={} frames/write={} bytes/write={} collapsed_move={} collapsed_stat={} hard_limit_kicks={}",
+            writes, frames,
+            writes ? double(frames) / double(writes) : 0.0,
+            writes ? bytes / writes : 0,
+            st.collapsed_move.load(std::memory_order_relaxed),
+            st.collapsed_stat.load(std::memory_order_relaxed),
+            st.hard_limit_kicks.load(std::memory_order_relaxed));
+
+        // 브로드캐스트 1회당 할당/복사 (공유 패킷이면 watcher 수와 무관하게 인코딩 1회 + 버퍼 1개)
+        const std::uint64_t bcasts = st.broadcasts.load(std::memory_order_relaxed);
+        const std::uint64_t watchers = st.broadcast_watchers.load(std::memory_order_relaxed);
+        LOG_INFO("[TcpServer] frame_allocs={} frame_copy_bytes={} shared_sends={} broadcasts={} watchers/broadcast={}",
+            st.frame_allocs.load(std::memory_order_relaxed),
+            st.frame_copy_bytes.load(std::memory_order_relaxed),
+            st.shared_sends.load(std::memory_order_relaxed),
+            bcasts,
+            bcasts ? double(watchers) / double(bcasts) : 0.0);
     }
 
 } // namespace net
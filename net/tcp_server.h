@@ -3,13 +3,19 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
 #include <uv.h>
 
 #include "net/session.h"
+#include "net/read_buffer_pool.h"
 #include "core/Dispatcher.h"
+#include "config/server_config.h"
+#include "core/affinity.h"
 
 namespace core {
-    class Worker;   
+    class Worker;
 }
 
 namespace net {
@@ -17,30 +23,75 @@ namespace net {
     class TcpServer
     {
     public:
+        // loop : 0번 I/O 루프 (메인 스레드가 uv_run 하는 루프)
+        // net  : io_threads > 1 이면 1..N-1번 루프는 TcpServer가 스레드를 만들어 직접 돌린다.
+        //        각 루프가 SO_REUSEPORT 리스너를 하나씩 가지고, accept 한 세션은 그 루프에 고정된다.
         TcpServer(uv_loop_t* loop,
             const char* ip,
             int port,
             core::Dispatcher* disp,
-            core::Worker* gameWorker); 
+            core::Worker* gameWorker,   // GameWorker 샤드가 없을 때만 사용
+            const config::NetConfig& net = {});
+        ~TcpServer();
 
-        void start();
+        // start() 전에 호출: I/O 루프 스레드를 cores 에 고정 (루프 수 <= 코어 수면 루프당 코어 1개)
+        void set_affinity(const core::CoreSet& cores) { cores_ = cores; }
 
+        void start();  // 0번 루프 스레드에서 호출 (그 스레드도 고정 대상)
+        void stop();   // 0번 루프 스레드에서 호출 (start 전이거나 start 도중 실패했어도 만든 루프/리스너/스레드를 모두 정리)
+
+        int io_loop_count() const { return static_cast<int>(loops_.size()); }
+
+        // 접속당 수신 메모리 리포트 (세션 객체 + 루프 공유 slab + 개인 꼬리 버퍼)
+        void log_memory_stats() const;
+
+        // 송신 리포트 (write 당 프레임 수 / syscall 당 바이트 / 수위 정책 발동 횟수)
+        void log_send_stats() const;
 
     private:
+        // I/O 루프 하나 = 리스너 하나 + 그 루프가 accept 한 세션들
+        struct IoLoop {
+            TcpServer*                 server{ nullptr };
+            int                        index{ 0 };
+            uv_loop_t*                 loop{ nullptr };
+            std::unique_ptr<uv_loop_t> owned;        // index > 0 인 루프만 소유
+            uv_tcp_t                   listener{};
+            bool                       listening{ false };   // listener 를 init 했다 (닫을 대상)
+            uv_async_t                 stop_async{};
+            std::thread                thread;
+            std::vector<Session::Ptr>  sessions;     // 이 루프 스레드에서만 접근
+            ReadBufferPool             read_pool;    // 이 루프 세션들이 공유하는 read slab
+            std::atomic<std::size_t>   connections{ 0 };
+
+            // 다른 루프가 회수한 이 루프 세션 -> reap_async 로 깨워 이 스레드에서 파괴
+            uv_async_t                 reap_async{};
+            std::mutex                 reapMutex;
+            std::vector<Session::Ptr>  reaped;       // reapMutex 보호
+            bool                       reapOpen{ false };   // reapMutex 보호 (close_loop 뒤에는 넣지 않는다)
+        };
+
         static void on_new_conn(uv_stream_t* s, int status);
+        static void on_stop_async(uv_async_t* h);
+        static void on_reap_async(uv_async_t* h);
+        static void reclaim_on_loop(IoLoop& io, Session::Ptr sess);
 
-        void on_session_closed(const Session::Ptr& sess);
+        void listen_on(IoLoop& io);
+        void close_loop(IoLoop& io);
+        void on_session_closed(IoLoop& io, const Session::Ptr& sess);
 
     private:
-        uv_loop_t* loop_;
         const char* ip_;
         int               port_;
         core::Dispatcher* dispatcher_;
 
-        core::Worker* gameWorker_;      
+        core::Worker* gameWorker_;
+
+        config::NetConfig net_;
+        core::CoreSet     cores_;
+        bool              started_{ false };
+        bool              stopped_{ false };
 
-        uv_tcp_t          server_;
-        std::vector<Session::Ptr> sessions_;
+        std::vector<std::unique_ptr<IoLoop>> loops_;
     };
 
 } // namespace net
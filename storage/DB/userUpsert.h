@@ -1,6 +1,6 @@
 #pragma once
 #include <vector>
-#include <mysql.h>  //⼭ MYSQL Ÿ Ȯ
+#include <mysql.h>  //여기서 MYSQL 타입을 확정
 
 #include "storage/redis/redisUserCache.h"
 
@@ -25,7 +25,7 @@ namespace storage {
     bool DBWorker::try_push(DbJob job) {
         {
             std::lock_guard<std::mutex> lk(mu_);
-            if (q_.size() >= max_queue_) return false;   //  á 
+            if (q_.size() >= max_queue_) return false;   // 꽉 찼으면 거절
             q_.push(std::move(job));
         }
         cv_.notify_one();
@@ -33,7 +33,7 @@ namespace storage {
     }
 
     void DBWorker::run() {
-        if (on_start_) on_start_();   // Ŀ 忡 1ȸ 
+        if (on_start_) on_start_();   // 워커 스레드에서 1회 실행
 
         while (true) {
             DbJob job;
@@ -51,7 +51,7 @@ namespace storage {
             if (handler_) handler_(job);
         }
 
-        if (on_stop_) on_stop_();     //   
+        if (on_stop_) on_stop_();     // 종료 직전 정리
     }
 
 } // namespace storage
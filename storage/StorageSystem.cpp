@@ -5,7 +5,6 @@
 #include <condition_variable>
 #include <queue>
 #include <vector>
-#include <iostream>
 #include <chrono>
 #include <algorithm>
 #include <mysql.h>
@@ -17,6 +16,8 @@
 #include "storage/redis/redisUserCache.h"
 #include "storage/DB/userUpsert.h"
 #include "storage/DB/Proc/userStateProc.h"
+#include "core/log.h"
+#include "core/affinity.h"
 
 
 namespace storage {
@@ -46,7 +47,7 @@ namespace storage {
 
             if (!ensure_connected()) {
 
-                std::cout << "[DBWorker] ensure_connected failed\n";
+                LOG_ERROR_RATE(1, "[DBWorker] ensure_connected failed");
                 return;
             }
 
@@ -57,7 +58,7 @@ namespace storage {
             if (job.uids.empty()) return;
 
             if (!storage::redis::FetchUsers(redis_ctx, job.uids, snap)) {
-                std::cout << "[DBWorker] FetchUsers failed -> disconnect\n";
+                LOG_ERROR("[DBWorker] FetchUsers failed -> disconnect");
                 disconnect_db();
                 return;
             }
@@ -65,7 +66,7 @@ namespace storage {
             if (snap.empty()) return;
 
             if (!storage::sql::CallSpUpsertUserStateBatch(mysql, snap)) {
-                std::cout << "[DBWorker] SP upsert failed: " << mysql_error(mysql) << "\n";
+                LOG_ERROR("[DBWorker] SP upsert failed: {}", mysql_error(mysql));
                 disconnect_db();
                 return;
             }
@@ -101,8 +102,7 @@ namespace storage {
                 );
 
                 if (!redis_ctx || redis_ctx->err) {
-                    std::cout << "[DBWorker] Redis connect failed: "
-                        << (redis_ctx ? redis_ctx->errstr : "null") << "\n";
+                    LOG_ERROR("[DBWorker] Redis connect failed: {}", redis_ctx ? redis_ctx->errstr : "null");
                     if (redis_ctx) {
                         redisFree(redis_ctx);
                         redis_ctx = nullptr;
@@ -112,7 +112,7 @@ namespace storage {
             }
             mysql = mysql_init(nullptr);
             if (!mysql) {
-                std::cout << "[DBWorker] mysql_init failed\n";
+                LOG_ERROR("[DBWorker] mysql_init failed");
                 disconnect_db();
                 return;
             }
@@ -128,15 +128,13 @@ namespace storage {
                 nullptr,
                 0
             )) {
-                std::cout << "[DBWorker] MySQL connect failed: "
-                    << mysql_error(mysql) << "\n";
+                LOG_ERROR("[DBWorker] MySQL connect failed: {}", mysql_error(mysql));
                 disconnect_db();
                 return;
             }
 
-            std::cout << "[DBWorker] DB connections established "
-                << "(redis " << cfg.redis.host << ":" << cfg.redis.port
-                << ", mysql " << cfg.mysql.host << ":" << cfg.mysql.port << ")\n";
+            LOG_INFO("[DBWorker] DB connections established (redis {}:{}, mysql {}:{})",
+                cfg.redis.host, cfg.redis.port, cfg.mysql.host, cfg.mysql.port);
         }
 
 
@@ -157,7 +155,10 @@ namespace storage {
             , cfg(c)
             , db(
                 [this](const DbJob& job) { this->handle_db_job(job); },
-                [this]() { this->connect_db(); },     //  워커 스레드에서 1회 connect
+                [this]() {                            //  워커 스레드에서 1회 코어 고정 + connect
+                    core::PinCurrentThread(core::CoreSet::Parse(cfg.placement.storage_cores));
+                    this->connect_db();
+                },
                 [this]() { this->disconnect_db(); }   // 워커 종료 시 close
             )
         {
@@ -232,7 +233,7 @@ namespace storage {
             if (mysql) { mysql_close(mysql); mysql = nullptr; }
 
 
-            std::cout << "[Storage] stopped.\n";
+            LOG_INFO("[Storage] stopped.");
         }
         bool start() {
             return start(cfg.storage.flush_interval_ms);
@@ -256,7 +257,7 @@ namespace storage {
                 disconnect_db();
                 return;
             }
-            std::cout << "[Storage] flush_rt_writes n=" << rt_local_.size() << "\n";
+            LOG_DEBUG("[Storage] flush_rt_writes n={}", rt_local_.size());
         }
 
     };
@@ -275,7 +276,7 @@ namespace storage {
 
     void StorageSystem::start() {
         if (!impl_) return;
-        if (!impl_->start()) std::cout << "[Storage] start failed\n";
+        if (!impl_->start()) LOG_ERROR("[Storage] start failed");
     }
 
     void StorageSystem::stop() {
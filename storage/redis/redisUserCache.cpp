@@ -62,12 +62,12 @@ namespace storage::redis {
                 (double)s.x, (double)s.z,
                 s.hp, s.sp) != REDIS_OK)
             {
-                // Append д  connection 
+                // Append 실패는 보통 connection 문제
                 return false;
             }
         }
 
-        // collect replies (  = snap.size())
+        // collect replies (명령 수 = snap.size())
         for (size_t i = 0; i < snap.size(); ++i) {
             redisReply* r = nullptr;
             if (redisGetReply(c, (void**)&r) != REDIS_OK) {
@@ -89,7 +89,7 @@ namespace storage::redis {
         if (!c) return false;
         if (uids.empty()) return true;
 
-        //  pipeline append: uid HMGET 1
+        //  pipeline append: uid마다 HMGET 1개
         for (auto uid : uids) {
             const auto krt = KeyRt(uid);
 
@@ -124,13 +124,13 @@ namespace storage::redis {
                 ok = okx && okz && okhp && oksp;
                 if (ok) {
                     s.x = x; s.z = z; s.hp = hp; s.sp = sp;
-                    s.inv_json.clear(); //  
+                    s.inv_json.clear(); // 현재는 무시
                 }
             }
 
             if (r) freeReplyObject(r);
 
-            if (ok) out.push_back(std::move(s)); // rt ȿ uid
+            if (ok) out.push_back(std::move(s)); // rt가 유효한 uid만
         }
 
         return true;
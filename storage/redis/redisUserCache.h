@@ -22,11 +22,11 @@ namespace storage::redis {
     std::string KeyRt(std::uint64_t uid);
     std::string KeyInv(std::uint64_t uid);
 
-    // rt Redis 
+    // rt만 Redis에 기록
     bool WriteUsersRtOnly(redisContext* c,
         const std::vector<UserSnapshot>& snap);
 
-    // rt Redis б ( uid out push)
+    // rt만 Redis에서 읽기 (성공한 uid만 out에 push)
     bool FetchUsers(redisContext* c,
         const std::vector<std::uint64_t>& uids,
         std::vector<UserSnapshot>& out);
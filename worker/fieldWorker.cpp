@@ -1,9 +1,10 @@
 ﻿// FieldWorker.cpp
 #include "fieldWorker.h"
 
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
 #include <cstdint>
-#include <iostream>
 #include <string>
 #include <utility>
 
@@ -11,6 +12,7 @@
 
 #include "net/session.h"
 #include "net/sessionManager.h"
+#include "net/session_table.h"
 
 #include "field/FieldAoiSystem.h"
 #include "field/FieldManager.h"
@@ -23,6 +25,8 @@
 #include "storage/StorageSystem.h"
 #include "storage/DirtyHub.h"
 
+#include "core/log.h"
+
 #include "proto/generated/field_generated.h"
 #include "proto/generated/game_generated.h"
 
@@ -60,55 +64,40 @@ namespace core {
     {
         init_monster_env();
 
-        aoiSystem_ = std::make_shared<FieldAoiSystem>(fieldId_, 15.0f, 2);
-        aoiSystem_->set_send_func([this](std::uint64_t watcherId, const AoiEvent& ev) {
-            auto sess = SessionManager::instance().find_by_player_id(watcherId);
-            if (!sess) return;
-
-            flatbuffers::FlatBufferBuilder fbb;
-
-            auto pos = field::CreateVec2(fbb, ev.position.x, ev.position.y);
-            const field::FieldCmdType cmdType = to_field_cmd_type(ev.type);
-
+        aoiSystem_ = std::make_shared<FieldAoiSystem>(fieldId_, kAoiSectorSize, 2);
+        aoiSystem_->set_send_func([this](std::uint64_t watcherId, std::uint32_t watcherSlot, const AoiEvent& ev) {
             const bool isMonster = is_monster_id(ev.subjectId);
-            const field::EntityType et = isMonster
-                ? field::EntityType::EntityType_Monster
-                : field::EntityType::EntityType_Player;
-
-            std::string prefabName = get_prefab_name(ev.subjectId, isMonster);
-            if (prefabName.empty()) prefabName = "Default";
-            auto prefabStr = fbb.CreateString(prefabName);
 
-            auto cmd = field::CreateFieldCmd(
-                fbb,
-                cmdType,
-                et,
-                ev.subjectId,
-                pos,
-                0,
-                prefabStr
-            );
-
-            auto envOffset = field::CreateEnvelope(
-                fbb,
-                field::Packet::Packet_FieldCmd,
-                cmd.Union()
-            );
-            fbb.Finish(envOffset);
-
-            sess->send_payload(
-                fbb.GetBufferPointer(),
-                static_cast<std::uint32_t>(fbb.GetSize())
-            );
+            PendingEvent pe;
+            pe.kind = field::Packet::Packet_FieldCmd;
+            pe.sub = static_cast<std::uint8_t>(to_field_cmd_type(ev.type));
+            pe.entityType = static_cast<std::uint8_t>(isMonster
+                ? field::EntityType::EntityType_Monster
+                : field::EntityType::EntityType_Player);
+            pe.subjectId = ev.subjectId;
+            pe.x = ev.position.x;
+            pe.y = ev.position.y;
+            if (ev.type != AoiEvent::Type::Leave) fill_velocity(pe);
+
+            // Move 는 밀리면 최신 위치로 합쳐도 되고, Enter/Leave 는 순서대로 꼭 보낸다
+            const net::SendClass cls = (ev.type == AoiEvent::Type::Move)
+                ? net::SendClass::Move
+                : net::SendClass::Reliable;
+
+            post_aoi_event(watcherId, watcherSlot, pe, cls);
             });
 
         set_on_message([this](const NetMessage& msg) { handle_message(msg); });
+        set_collapse_key([this](NetMessage& msg) { return move_collapse_key(msg); });
+        set_tick(TickPeriod, [this](float dt) { update_world(dt); }, TickDrainBudget);
 
-        if (fieldId == 1000) {
-            SpawnMonstersEvenGrid(1000);
-        }
-
-        aoiSystem_->set_initialized(true);
+        // 몬스터 스폰은 필드를 돌릴 스레드에서 (ECS/AOI 메모리가 그 스레드의 NUMA 노드에 잡힘)
+        set_on_start([this] {
+            if (fieldId_ == 1000) {
+                SpawnMonstersEvenGrid(1000);
+            }
+            aoiSystem_->set_initialized(true);
+            });
     }
 
     FieldWorker::~FieldWorker() = default;
@@ -118,27 +107,114 @@ namespace core {
         if (!aoiSystem_) return;
 
         if (msg.type == MessageType::SkillCmd) {
-            handle_skill(msg);
+            // GameWorker 가 verify 끝난 Envelope 에서 값만 꺼내 넘긴다
+            auto* skill = std::get_if<SkillCmdData>(&msg.cmd);
+            if (!skill) {
+                LOG_WARN_RATE(10, "[Field] SkillCmd without data");
+                return;
+            }
+            handle_skill(msg.session, *skill);
+            return;
+        }
+        if (msg.type == MessageType::NetEnvelope) {
+            SkillCmdData skill;
+            if (decode_skill_input(msg, skill)) {
+                handle_skill(msg.session, skill);
+            }
+            return;
+        }
+        if (msg.type == MessageType::EnterField) {
+            handle_enter_field(msg);
+            return;
+        }
+        if (msg.type == MessageType::LeaveField) {
+            handle_leave_field(msg);
+            return;
+        }
+        if (msg.type == MessageType::MoveField) {
+            if (auto* mv = std::get_if<MoveCmdData>(&msg.cmd)) {
+                on_client_move_input(*mv);
+            }
+            else if (auto* mp = std::get_if<MovePosData>(&msg.cmd)) {
+                on_move_pos(*mp);
+            }
             return;
         }
 
         if (msg.type != MessageType::Custom) return;
 
+        // 합치기를 거치지 않은 와이어 입력 (묶음에 1개뿐이었던 경우 등)
+        MoveCmdData mv;
+        if (decode_move_input(msg, mv)) {
+            on_client_move_input(mv);
+        }
+    }
+
+    // I/O 스레드는 route 바이트만 보고 넘기므로 verify 는 여기서 1회
+    bool FieldWorker::decode_move_input(const NetMessage& msg, MoveCmdData& out)
+    {
+        net::Session* session = net::ResolveSession(msg.session);
+        if (!session) return false;   // 이미 닫힌 세션
+
         const uint8_t* buf = msg.payload.data();
-        auto env = field::GetEnvelope(buf);
-        if (!env) {
-            std::cout << "[WARN] Invalid field envelope\n";
-            return;
+        flatbuffers::Verifier verifier(buf, msg.payload.size());
+        if (!verifier.VerifyBuffer<field::Envelope>(nullptr)) {
+            LOG_WARN_RATE(10, "[Field] Invalid field envelope len={}", msg.payload.size());
+            return false;
         }
 
-        if (env->pkt_type() != field::Packet::Packet_FieldCmd) return;
+        auto env = field::GetEnvelope(buf);
+        if (!env || env->pkt_type() != field::Packet::Packet_FieldCmd) return false;
 
         auto* cmd = env->pkt_as_FieldCmd();
-        if (!cmd) return;
+        if (!cmd || cmd->type() != field::FieldCmdType::FieldCmdType_Move) return false;
+
+        // 남의 entityId 로 보낸 입력은 버린다
+        const std::uint64_t pid = session->player_id();
+        if (pid == 0 || cmd->entityId() != pid) return false;
+
+        auto* dir = cmd->dir();
+        if (!dir) return false;
+
+        out.playerId = pid;
+        out.dirX = dir->x();
+        out.dirY = dir->y();
+        return true;
+    }
+
+    bool FieldWorker::decode_skill_input(const NetMessage& msg, SkillCmdData& out)
+    {
+        const uint8_t* buf = msg.payload.data();
+        flatbuffers::Verifier verifier(buf, msg.payload.size());
+        if (!game::VerifyEnvelopeBuffer(verifier)) {
+            LOG_WARN_RATE(10, "[Field] Invalid game envelope len={}", msg.payload.size());
+            return false;
+        }
+
+        auto* sk = game::GetEnvelope(buf)->pkt_as_SkillCmd();
+        if (!sk) return false;   // 라우트 테이블에 SkillCmd 만 있다
+
+        out.skill = static_cast<std::int8_t>(sk->skill());
+        out.targetId = sk->targetId();
+        out.recvAt = current_enqueued_at();
+        return true;
+    }
 
-        if (cmd->type() == field::FieldCmdType::FieldCmdType_Move) {
-            on_client_move_input(*cmd, msg.session);
+    std::uint64_t FieldWorker::move_collapse_key(NetMessage& msg)
+    {
+        if (msg.type == MessageType::MoveField) {
+            auto* mv = std::get_if<MoveCmdData>(&msg.cmd);
+            return mv ? mv->playerId : 0;
         }
+        if (msg.type != MessageType::Custom) return 0;
+
+        MoveCmdData mv;
+        if (!decode_move_input(msg, mv)) return 0;
+
+        // 풀어 둔 값으로 처리하므로 handle_message 에서 다시 verify 하지 않는다
+        msg.type = MessageType::MoveField;
+        msg.cmd = mv;
+        return mv.playerId;
     }
 
     void FieldWorker::write_player_rt_enqueue(uint64_t uid, const Player& p)
@@ -158,20 +234,13 @@ namespace core {
         redisRtWriter_(s);
     }
 
-    void FieldWorker::on_client_move_input(const field::FieldCmd& cmd, net::Session::Ptr session)
+    void FieldWorker::on_client_move_input(const MoveCmdData& cmd)
     {
-        if (!session) return;
-        if (session->player_id() != cmd.entityId()) return;
-        if (cmd.type() != field::FieldCmdType::FieldCmdType_Move) return;
-
-        auto it = players_.find(cmd.entityId());
+        auto it = players_.find(cmd.playerId);
         if (it == players_.end()) return;
 
-        auto* dir = cmd.dir();
-        if (!dir) return;
-
-        float dx = dir->x();
-        float dy = dir->y();
+        float dx = cmd.dirX;
+        float dy = cmd.dirY;
         const float len2 = dx * dx + dy * dy;
 
         auto& mv = it->second->move_state();
@@ -184,7 +253,7 @@ namespace core {
             mv.dir = { 0.f, 0.f };
             mv.speed = 0.f;
 
-            env_.broadcastPlayerState(cmd.entityId(), monster_ecs::PlayerState::Idle);
+            env_.broadcastPlayerState(cmd.playerId, monster_ecs::PlayerState::Idle);
             return;
         }
 
@@ -198,8 +267,24 @@ namespace core {
         mv.speed = 4.5f;
 
         if (!wasMoving) {
-            env_.broadcastPlayerState(cmd.entityId(), monster_ecs::PlayerState::Chase);
+            env_.broadcastPlayerState(cmd.playerId, monster_ecs::PlayerState::Chase);
+        }
+    }
+
+    void FieldWorker::on_move_pos(const MovePosData& cmd)
+    {
+        auto it = players_.find(cmd.playerId);
+        if (it == players_.end() || !it->second) return;
+
+        Player& player = *it->second;
+        const Vec2 oldPos = player.pos();
+        const Vec2 newPos{ cmd.x, cmd.y };
+
+        player.set_pos(newPos.x, newPos.y);
+        if (aoiSystem_) {
+            aoiSystem_->move_entity(cmd.playerId, newPos.x, newPos.y);
         }
+        mark_dirty_pos_if_needed(player, oldPos, newPos);
     }
 
     void FieldWorker::add_player(Player::Ptr player)
@@ -207,17 +292,136 @@ namespace core {
         if (!player) return;
 
         const uint64_t pid = player->id();
+        // 같은 필드 재입장(또는 재접속으로 바뀐 Player): 이전 것을 먼저 내보내 칸/AOI 를 한 벌만 둔다
+        //  - 방금 돌려준 칸을 아래에서 바로 다시 집는다
+        if (players_.count(pid)) remove_player(pid);
         players_[pid] = player;
 
+        auto sess = player->session();
+        if (sess) {
+            std::uint32_t slot = 0;
+            if (!freeWatcherSlots_.empty()) {
+                slot = freeWatcherSlots_.back();
+                freeWatcherSlots_.pop_back();
+            }
+            else {
+                slot = static_cast<std::uint32_t>(watcherSlots_.size());
+                watcherSlots_.emplace_back();
+            }
+            WatcherSlot& w = watcherSlots_[slot];
+            w.playerId = pid;
+            w.session = sess->handle();
+            w.pending.clear();
+            player->set_field_slot(slot);
+            if (aoiSystem_) aoiSystem_->set_watcher_slot(pid, slot);
+        }
+        playerCount_.store(players_.size(), std::memory_order_relaxed);
+
         on_player_enter_field(player);
     }
 
+    net::Session* FieldWorker::watcher_session(std::uint64_t playerId, std::uint32_t slot) const
+    {
+        if (slot < watcherSlots_.size()) {
+            const WatcherSlot& w = watcherSlots_[slot];
+            if (w.playerId == playerId) {
+                return net::ResolveSession(w.session);
+            }
+        }
+        return net::ResolveSession(net::SessionManager::instance().resolve_player(playerId));
+    }
+
+    void FieldWorker::log_stats() const
+    {
+        log_mailbox_stats();
+        LOG_INFO("[Field] {} skills={} skill_latency_us p50<={} p99<={} max={}",
+            fieldId_, skillLatency_.count(),
+            skillLatency_.percentile_us(0.50), skillLatency_.percentile_us(0.99), skillLatency_.max_us());
+        if (aoiSystem_) {
+            const std::uint64_t encodes = aoiEncodes_.load(std::memory_order_relaxed);
+            const std::uint64_t sends = aoiSends_.load(std::memory_order_relaxed);
+            LOG_INFO("[Field] {} aoi staged_moves={} coalesced_moves={} encodes={} sends={} sends/encode={}",
+                fieldId_, aoiSystem_->staged_moves(), aoiSystem_->coalesced_moves(), encodes, sends,
+                encodes ? double(sends) / double(encodes) : 0.0);
+        }
+
+        // 위치 모드라면 steps 만큼 Move 가 나갔을 것 (watcher 수를 곱하기 전, 엔티티 기준)
+        const std::uint64_t steps = moveSteps_.load(std::memory_order_relaxed);
+        const std::uint64_t sends = moveSends_.load(std::memory_order_relaxed);
+        LOG_INFO("[Field] {} move_rep={} move_steps={} move_sends={} sends/step={}",
+            fieldId_, velocityRep_ ? "velocity" : "position", steps, sends,
+            steps ? double(sends) / double(steps) : 0.0);
+
+        const auto now = std::chrono::steady_clock::now();
+        const double sec = std::chrono::duration<double>(now - statsLastTime_).count();
+        const std::uint64_t msgs = moveMsgs_.load(std::memory_order_relaxed);
+        const std::uint64_t bytes = moveMsgBytes_.load(std::memory_order_relaxed);
+        const std::size_t players = playerCount_.load(std::memory_order_relaxed);
+        const double rate = sec > 0.0 ? double(bytes - statsLastMoveBytes_) / sec : 0.0;
+        statsLastTime_ = now;
+        statsLastMoveBytes_ = bytes;
+        LOG_INFO("[Field] {} move_encoding={} move_msgs={} bytes/move={} move_bytes/s/player={}",
+            fieldId_, compactMoves_ ? "compact" : "fieldcmd", msgs,
+            msgs ? double(bytes) / double(msgs) : 0.0,
+            players ? rate / double(players) : 0.0);
+
+        if (bundleEvents_) {
+            // 이벤트별 전송과 비교: 프레임 수 = 패킷 수, 바이트는 TcpServer 송신 통계와 같이 본다
+            const std::uint64_t frames = bundleFrames_.load(std::memory_order_relaxed);
+            const std::uint64_t events = bundledEvents_.load(std::memory_order_relaxed);
+            const std::uint64_t bytes = bundleBytes_.load(std::memory_order_relaxed);
+            LOG_INFO("[Field] {} bundles frames={} events={} events/frame={} bytes/frame={}",
+                fieldId_, frames, events,
+                frames ? double(events) / double(frames) : 0.0,
+                frames ? double(bytes) / double(frames) : 0.0);
+        }
+    }
+
+    void FieldWorker::handle_enter_field(const NetMessage& msg)
+    {
+        auto* enter = std::get_if<EnterFieldData>(&msg.cmd);
+        if (!enter) return;
+
+        auto player = PlayerManager::instance().get_by_id(enter->playerId);
+        if (!player) return;
+
+        // 이전 필드 워커는 LeaveField 를 먼저 받아 이 플레이어를 놓았다 (같은 GameWorker 가 순서대로 넣음)
+        player->set_field_id(static_cast<int>(enter->fieldId));
+        player->set_pos(enter->x, enter->y);
+        add_player(player);
+    }
+
+    void FieldWorker::handle_leave_field(const NetMessage& msg)
+    {
+        auto* ref = std::get_if<PlayerRefData>(&msg.cmd);
+        if (!ref) return;
+        remove_player(ref->playerId);
+    }
+
     void FieldWorker::remove_player(std::uint64_t playerId)
     {
+        replicate_stop(playerId);
         if (aoiSystem_) {
             aoiSystem_->remove_entity(playerId);
         }
-        players_.erase(playerId);
+
+        auto it = players_.find(playerId);
+        if (it == players_.end()) return;
+
+        if (it->second) {
+            const std::uint32_t slot = it->second->field_slot();
+            if (slot < watcherSlots_.size() && watcherSlots_[slot].playerId == playerId) {
+                WatcherSlot& w = watcherSlots_[slot];
+                w.playerId = 0;
+                w.session = {};
+                w.pending.clear();   // 나간 사람 몫은 버린다 (dirtyWatchers_ 에 남아도 flush 가 건너뜀)
+                freeWatcherSlots_.push_back(slot);
+            }
+            it->second->set_field_slot(UINT32_MAX);
+        }
+        moveRep_.erase(playerId);
+        players_.erase(it);
+        playerCount_.store(players_.size(), std::memory_order_relaxed);
     }
 
     void FieldWorker::update_world(float dt)
@@ -226,6 +430,9 @@ namespace core {
 
         worldTime_ += dt;
 
+        // 서브스텝/catch-up 동안의 AOI 이동은 (watcher, subject) 당 마지막 것만 보낸다
+        if (aoiSystem_) aoiSystem_->begin_stage();
+
         int playerLoops = 0;
         playerAcc_ += dt;
         while (playerAcc_ >= PlayerStep && playerLoops < 5) {
@@ -241,6 +448,12 @@ namespace core {
             monsterAcc_ -= MonsterStep;
             ++monsterLoops;
         }
+
+        if (aoiSystem_) aoiSystem_->flush_stage();
+
+        // 틱 사이 메시지 처리분 + 이번 틱 이벤트를 watcher 당 한 프레임으로
+        flush_bundles();
+        aoiLastPkt_.reset();
     }
 
     bool FieldWorker::is_walkable(const Vec2& from, const Vec2& to) const
@@ -251,71 +464,35 @@ namespace core {
     }
 
     void FieldWorker::send_combat_event(field::EntityType attackerType, uint64_t attackerId,
-        field::EntityType targetType, uint64_t targetId, int damage, int remainHp)
+        field::EntityType targetType, uint64_t targetId, std::uint32_t targetSlot, int damage, int remainHp)
     {
-        auto sess = net::SessionManager::instance().find_by_player_id(targetId);
-        if (!sess) return;
-
-        flatbuffers::FlatBufferBuilder fbb;
-
-        auto evOffset = field::CreateCombatEvent(
-            fbb,
-            attackerType,
-            attackerId,
-            targetType,
-            targetId,
-            damage,
-            remainHp
-        );
-
-        auto envOffset = field::CreateEnvelope(
-            fbb,
-            field::Packet::Packet_CombatEvent,
-            evOffset.Union()
-        );
-
-        fbb.Finish(envOffset);
-
-        sess->send_payload(
-            fbb.GetBufferPointer(),
-            static_cast<std::uint32_t>(fbb.GetSize())
-        );
+        PendingEvent ev;
+        ev.kind = field::Packet::Packet_CombatEvent;
+        ev.sub = static_cast<std::uint8_t>(attackerType);
+        ev.otherId = attackerId;
+        ev.entityType = static_cast<std::uint8_t>(targetType);
+        ev.subjectId = targetId;
+        ev.v[0] = damage;
+        ev.v[1] = remainHp;
+
+        post_event(targetId, targetSlot, ev);
     }
 
-    void FieldWorker::send_stat_event(std::uint64_t watcherId, std::uint64_t subjectId, bool isMonster,
+    void FieldWorker::send_stat_event(std::uint64_t watcherId, std::uint32_t watcherSlot, std::uint64_t subjectId, bool isMonster,
         int hp, int maxHp, int sp, int maxSp)
     {
-        auto sess = net::SessionManager::instance().find_by_player_id(watcherId);
-        if (!sess) return;
-
-        flatbuffers::FlatBufferBuilder fbb;
-
-        field::EntityType et = isMonster
+        PendingEvent ev;
+        ev.kind = field::Packet::Packet_StatEvent;
+        ev.entityType = static_cast<std::uint8_t>(isMonster
             ? field::EntityType::EntityType_Monster
-            : field::EntityType::EntityType_Player;
-
-        auto statOffset = field::CreateStatEvent(
-            fbb,
-            et,
-            subjectId,
-            hp,
-            maxHp,
-            sp,
-            maxSp
-        );
-
-        auto envOffset = field::CreateEnvelope(
-            fbb,
-            field::Packet::Packet_StatEvent,
-            statOffset.Union()
-        );
-
-        fbb.Finish(envOffset);
-
-        sess->send_payload(
-            fbb.GetBufferPointer(),
-            static_cast<std::uint32_t>(fbb.GetSize())
-        );
+            : field::EntityType::EntityType_Player);
+        ev.subjectId = subjectId;
+        ev.v[0] = hp;
+        ev.v[1] = maxHp;
+        ev.v[2] = sp;
+        ev.v[3] = maxSp;
+
+        post_event(watcherId, watcherSlot, ev, net::SendClass::Stat, subjectId);
     }
 
     void FieldWorker::monster_spawn_in_aoi(std::uint64_t monsterId, float x, float y)
@@ -332,31 +509,21 @@ namespace core {
         }
     }
 
-    void FieldWorker::handle_skill(const NetMessage& msg)
+    void FieldWorker::handle_skill(net::SessionHandle sessionHandle, const SkillCmdData& skill)
     {
-        auto session = msg.session;
-        if (!session) return;
+        net::Session* session = net::ResolveSession(sessionHandle);
+        if (!session) return;   // 처리 전에 끊긴 세션
 
         const uint64_t pid = session->player_id();
+        if (players_.find(pid) == players_.end()) return;   // 이 필드에 없는 플레이어 (필드 이동 직후 등)
 
-        flatbuffers::Verifier verifier(
-            reinterpret_cast<const uint8_t*>(msg.payload.data()),
-            msg.payload.size()
-        );
-
-        if (!verifier.VerifyBuffer<game::SkillCmd>(nullptr)) {
-            std::cout << "[WARN] Invalid SkillCmd\n";
-            return;
-        }
-
-        auto skill = flatbuffers::GetRoot<game::SkillCmd>(msg.payload.data());
-        if (!skill) {
-            std::cout << "[WARN] SkillCmd null\n";
-            return;
+        if (skill.recvAt.time_since_epoch().count() != 0) {
+            skillLatency_.record(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - skill.recvAt).count());
         }
 
-        const auto skillType = skill->skill();
-        const uint64_t targetId = skill->targetId();
+        const auto skillType = static_cast<game::SkillType>(skill.skill);
+        const uint64_t targetId = skill.targetId;
 
         env_.broadcastPlayerState(pid, monster_ecs::PlayerState::Attack);
 
@@ -381,45 +548,20 @@ namespace core {
         return "";
     }
 
-    void FieldWorker::send_field_enter(std::uint64_t watcherId, std::uint64_t subjectId, bool isMonster, const Vec2& pos)
+    void FieldWorker::send_field_enter(std::uint64_t watcherId, std::uint32_t watcherSlot, std::uint64_t subjectId, bool isMonster, const Vec2& pos)
     {
-        auto sess = net::SessionManager::instance().find_by_player_id(watcherId);
-        if (!sess) return;
-
-        flatbuffers::FlatBufferBuilder fbb;
-
-        auto posOffset = field::CreateVec2(fbb, pos.x, pos.y);
-
-        field::EntityType et = isMonster
+        PendingEvent ev;
+        ev.kind = field::Packet::Packet_FieldCmd;
+        ev.sub = static_cast<std::uint8_t>(field::FieldCmdType::FieldCmdType_Enter);
+        ev.entityType = static_cast<std::uint8_t>(isMonster
             ? field::EntityType::EntityType_Monster
-            : field::EntityType::EntityType_Player;
+            : field::EntityType::EntityType_Player);
+        ev.subjectId = subjectId;
+        ev.x = pos.x;
+        ev.y = pos.y;
+        fill_velocity(ev);
 
-        std::string prefabName = get_prefab_name(subjectId, isMonster);
-        if (prefabName.empty()) prefabName = "Default";
-        auto prefabStr = fbb.CreateString(prefabName);
-
-        auto cmd = field::CreateFieldCmd(
-            fbb,
-            field::FieldCmdType::FieldCmdType_Enter,
-            et,
-            subjectId,
-            posOffset,
-            0,
-            prefabStr
-        );
-
-        auto envOffset = field::CreateEnvelope(
-            fbb,
-            field::Packet::Packet_FieldCmd,
-            cmd.Union()
-        );
-
-        fbb.Finish(envOffset);
-
-        sess->send_payload(
-            fbb.GetBufferPointer(),
-            static_cast<std::uint32_t>(fbb.GetSize())
-        );
+        post_event(watcherId, watcherSlot, ev, net::SendClass::Reliable, subjectId);
     }
 
     void FieldWorker::on_player_enter_field(Player::Ptr player)
@@ -433,21 +575,23 @@ namespace core {
             aoiSystem_->add_entity(pid, true, p.x, p.y);
         }
 
-        send_field_enter(pid, pid, false, p);
+        const std::uint32_t slot = player->field_slot();
+
+        send_field_enter(pid, slot, pid, false, p);
 
         for (auto& [otherId, other] : players_) {
             if (otherId == pid || !other) continue;
-            send_field_enter(pid, otherId, false, other->pos());
+            send_field_enter(pid, slot, otherId, false, other->pos());
         }
 
         for (auto mId : monsterWorld_.monsters) {
             auto& tr = monsterWorld_.transform.get(mId);
-            send_field_enter(pid, mId, true, Vec2{ tr.x, tr.y });
+            send_field_enter(pid, slot, mId, true, Vec2{ tr.x, tr.y });
         }
 
         for (auto& [otherId, other] : players_) {
             if (otherId == pid || !other) continue;
-            send_field_enter(otherId, pid, false, p);
+            send_field_enter(otherId, other->field_slot(), pid, false, p);
         }
     }
 
@@ -483,16 +627,21 @@ namespace core {
             };
 
         env_.moveInAoi = [this](uint64_t mid, float x, float y) {
-            if (aoiSystem_) aoiSystem_->move_entity(mid, x, y);
+            // 속도 모드면 Move 는 tick_monsters 끝의 replicate_move 가 낸다
+            if (aoiSystem_) aoiSystem_->move_entity(mid, x, y, !velocityRep_);
             };
 
         env_.spawnInAoi = [this](uint64_t mid, float x, float y) {
             if (!aoiSystem_) return;
+            replicate_stop(mid);
+            moveRep_.erase(mid);
             aoiSystem_->remove_entity(mid);
             aoiSystem_->add_entity(mid, false, x, y);
             };
 
         env_.removeFromAoi = [this](uint64_t mid) {
+            replicate_stop(mid);
+            moveRep_.erase(mid);
             if (aoiSystem_) aoiSystem_->remove_entity(mid);
             };
 
@@ -512,7 +661,7 @@ namespace core {
 
             send_combat_event(
                 field::EntityType::EntityType_Monster, monsterId,
-                field::EntityType::EntityType_Player, playerId,
+                field::EntityType::EntityType_Player, playerId, it->second->field_slot(),
                 damage,
                 st.hp
             );
@@ -584,16 +733,91 @@ namespace core {
             player.set_pos(newPos.x, newPos.y);
 
             if (aoiSystem_) {
-                aoiSystem_->move_entity(pid, newPos.x, newPos.y);
+                aoiSystem_->move_entity(pid, newPos.x, newPos.y, !velocityRep_);
             }
+            moveSteps_.fetch_add(1, std::memory_order_relaxed);
 
             mark_dirty_pos_if_needed(player, oldPos, newPos);
         }
+
+        if (!velocityRep_) return;
+        for (auto& [pid, playerPtr] : players_) {
+            if (!playerPtr) continue;
+            const auto& mv = playerPtr->move_state();
+            if (mv.moving) replicate_move(pid, mv.dir.x, mv.dir.y, mv.speed);
+            else           replicate_move(pid, 0.0f, 0.0f, 0.0f);
+        }
     }
 
     void FieldWorker::tick_monsters(float step)
     {
         monsterWorld_.update(step, env_);
+
+        for (auto e : monsterWorld_.monsters) {
+            const auto& ai = monsterWorld_.aiComp.get(e);
+            if (ai.state == monster_ecs::CAI::State::Dead) {
+                replicate_stop(e);   // 움직이다 죽었으면 외삽을 멈추게 한다
+                continue;
+            }
+            if (ai.moveSpeed > 0.0f) moveSteps_.fetch_add(1, std::memory_order_relaxed);
+            if (velocityRep_) replicate_move(e, ai.moveDirX, ai.moveDirY, ai.moveSpeed);
+        }
+    }
+
+    void FieldWorker::replicate_move(std::uint64_t id, float dirX, float dirY, float speed)
+    {
+        constexpr float kDirCos = 0.995f;     // 약 5.7도 넘게 꺾이면 다시 보낸다 (추적 중 미세한 방향 변화는 보정 주기에 맡김)
+        constexpr float kSpeedEps = 0.05f;
+
+        if (speed <= 0.0f) {
+            dirX = dirY = speed = 0.0f;
+        }
+
+        auto [it, inserted] = moveRep_.try_emplace(id);
+        MoveRep& r = it->second;
+
+        bool send = inserted && speed > 0.0f;
+        if (!send) {
+            const bool wasMoving = r.speed > 0.0f;
+            const bool moving = speed > 0.0f;
+            if (wasMoving != moving) send = true;
+            else if (moving) {
+                send = std::fabs(speed - r.speed) > kSpeedEps
+                    || (dirX * r.dirX + dirY * r.dirY) < kDirCos
+                    || (worldTime_ - r.sentAt) >= moveCorrectionSec_;
+            }
+        }
+        if (!send) return;
+
+        r.dirX = dirX;
+        r.dirY = dirY;
+        r.speed = speed;
+        r.sentAt = worldTime_;
+
+        if (aoiSystem_) aoiSystem_->notify_move(id);
+        moveSends_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void FieldWorker::replicate_stop(std::uint64_t id)
+    {
+        if (!velocityRep_) return;
+
+        auto it = moveRep_.find(id);
+        if (it == moveRep_.end() || it->second.speed <= 0.0f) return;
+        replicate_move(id, 0.0f, 0.0f, 0.0f);
+    }
+
+    void FieldWorker::fill_velocity(PendingEvent& ev) const
+    {
+        if (!velocityRep_) return;
+
+        ev.hasVel = true;
+        auto it = moveRep_.find(ev.subjectId);
+        if (it == moveRep_.end()) return;   // 아직 안 움직임 = 정지
+
+        ev.dirX = it->second.dirX;
+        ev.dirY = it->second.dirY;
+        ev.speed = it->second.speed;
     }
 
     void FieldWorker::SpawnMonstersEvenGrid(int fieldId)
@@ -649,34 +873,337 @@ namespace core {
         }
     }
 
-    void FieldWorker::broadcast_ai_state(uint64_t entityId, field::EntityType et, field::AiStateType fbState)
+    void FieldWorker::broadcast_packet(std::uint64_t subjectId, flatbuffers::FlatBufferBuilder& fbb,
+        net::SendClass cls, std::uint64_t key)
     {
-        aoiSystem_->for_each_watcher(entityId, [&](uint64_t watcherId) {
-            auto sess = net::SessionManager::instance().find_by_player_id(watcherId);
+        // watcher 수와 상관없이 프레이밍/할당은 1회
+        net::SharedPacket pkt;
+        std::uint64_t sent = 0;
+
+        aoiSystem_->for_each_watcher(subjectId, [&](uint64_t watcherId, std::uint32_t watcherSlot) {
+            auto sess = watcher_session(watcherId, watcherSlot);
             if (!sess) return;
 
-            flatbuffers::FlatBufferBuilder fbb;
+            if (!pkt) {
+                pkt = net::MakeSharedPacket(fbb.GetBufferPointer(), static_cast<std::uint32_t>(fbb.GetSize()));
+                if (!pkt) return;
+            }
+            sess->send_shared(pkt, cls, key);
+            ++sent;
+            });
 
-            auto evOffset = field::CreateAiStateEvent(
-                fbb,
-                et,
-                entityId,
-                fbState
-            );
+        if (sent == 0) return;
+        auto& st = net::send_stats();
+        st.broadcasts.fetch_add(1, std::memory_order_relaxed);
+        st.broadcast_watchers.fetch_add(sent, std::memory_order_relaxed);
+    }
+
+    void FieldWorker::set_move_encoding(bool compact, float precision)
+    {
+        moveQuant_.configure(kAoiSectorSize, precision);
+
+        // MoveBatch 는 watcher 별 틱 묶음(EventBundle)에만 실린다 (설정 로드에서 막지만 직접 호출 대비)
+        if (compact && !bundleEvents_) {
+            LOG_ERROR("[Field] {} compact moves require event bundles, using fieldcmd", fieldId_);
+            compact = false;
+        }
+        compactMoves_ = compact;
+        if (!compact) return;
+
+        // 참조 디코더로 왕복 오차 확인 (필드 크기 500m 기준, float 반올림 여유 포함)
+        constexpr float kExtent = 500.0f;
+        const float err = moveQuant_.self_check(kExtent);
+        const float bound = moveQuant_.max_pos_error() + kExtent * 4.0f * FLT_EPSILON;
+        if (err > bound) {
+            LOG_WARN("[Field] {} compact move round-trip error {} > {} (unit={})",
+                fieldId_, err, bound, moveQuant_.unit());
+        }
+        else {
+            LOG_INFO("[Field] {} compact moves unit={}m max_err={}m max_speed={}m/s",
+                fieldId_, moveQuant_.unit(), err, field::MoveQuantizer::kMaxSpeed);
+        }
+    }
+
+    field::Packet FieldWorker::wire_kind(const PendingEvent& ev) const
+    {
+        if (compactMoves_
+            && ev.kind == field::Packet::Packet_FieldCmd
+            && ev.sub == static_cast<std::uint8_t>(field::FieldCmdType::FieldCmdType_Move)) {
+            return field::Packet::Packet_MoveBatch;
+        }
+        return ev.kind;
+    }
 
-            auto envOffset = field::CreateEnvelope(
+    field::PackedMove FieldWorker::pack_move(const PendingEvent& ev) const
+    {
+        const field::QuantMove q = moveQuant_.encode(ev.x, ev.y, ev.dirX, ev.dirY, ev.speed);
+        return field::PackedMove(ev.subjectId, q.sx, q.sy, q.ox, q.oy, q.heading, q.speed);
+    }
+
+    // sectorSize/unit 은 배치마다 1번 (Move 1건당 24바이트)
+    flatbuffers::Offset<void> FieldWorker::encode_move_batch(flatbuffers::FlatBufferBuilder& fbb,
+        const field::PackedMove* moves, std::size_t count)
+    {
+        const auto before = fbb.GetSize();
+        auto vec = fbb.CreateVectorOfStructs(moves, count);
+        const auto offset = field::CreateMoveBatch(
+            fbb,
+            moveQuant_.sector_size(),
+            moveQuant_.unit(),
+            vec
+        ).Union();
+
+        moveMsgs_.fetch_add(count, std::memory_order_relaxed);
+        moveMsgBytes_.fetch_add(fbb.GetSize() - before, std::memory_order_relaxed);
+        return offset;
+    }
+
+    flatbuffers::Offset<void> FieldWorker::encode_event(flatbuffers::FlatBufferBuilder& fbb, const PendingEvent& ev)
+    {
+        if (wire_kind(ev) == field::Packet::Packet_MoveBatch) {
+            const field::PackedMove pm = pack_move(ev);
+            return encode_move_batch(fbb, &pm, 1);   // 묶음 밖 경로 (칸을 모르는 watcher)
+        }
+
+        const bool isMove = is_move(ev);
+        const auto before = fbb.GetSize();
+        const auto offset = encode_event_body(fbb, ev);
+        if (isMove) {
+            moveMsgs_.fetch_add(1, std::memory_order_relaxed);
+            moveMsgBytes_.fetch_add(fbb.GetSize() - before, std::memory_order_relaxed);
+        }
+        return offset;
+    }
+
+    flatbuffers::Offset<void> FieldWorker::encode_event_body(flatbuffers::FlatBufferBuilder& fbb, const PendingEvent& ev)
+    {
+        switch (ev.kind) {
+        case field::Packet::Packet_FieldCmd: {
+            const bool isMonster = ev.entityType == static_cast<std::uint8_t>(field::EntityType::EntityType_Monster);
+            std::string prefabName = get_prefab_name(ev.subjectId, isMonster);
+            if (prefabName.empty()) prefabName = "Default";
+            auto prefabStr = fbb.CreateString(prefabName);
+            auto pos = field::CreateVec2(fbb, ev.x, ev.y);
+            flatbuffers::Offset<field::Vec2> dir = 0;
+            if (ev.hasVel) dir = field::CreateVec2(fbb, ev.dirX, ev.dirY);
+
+            return field::CreateFieldCmd(
                 fbb,
-                field::Packet::Packet_AiStateEvent,
-                evOffset.Union()
-            );
+                static_cast<field::FieldCmdType>(ev.sub),
+                static_cast<field::EntityType>(ev.entityType),
+                ev.subjectId,
+                pos,
+                dir,
+                prefabStr,
+                ev.hasVel ? ev.speed : 0.0f
+            ).Union();
+        }
+        case field::Packet::Packet_CombatEvent:
+            return field::CreateCombatEvent(
+                fbb,
+                static_cast<field::EntityType>(ev.sub),
+                ev.otherId,
+                static_cast<field::EntityType>(ev.entityType),
+                ev.subjectId,
+                ev.v[0],
+                ev.v[1]
+            ).Union();
+        case field::Packet::Packet_AiStateEvent:
+            return field::CreateAiStateEvent(
+                fbb,
+                static_cast<field::EntityType>(ev.entityType),
+                ev.subjectId,
+                static_cast<field::AiStateType>(ev.sub)
+            ).Union();
+        case field::Packet::Packet_StatEvent:
+            return field::CreateStatEvent(
+                fbb,
+                static_cast<field::EntityType>(ev.entityType),
+                ev.subjectId,
+                ev.v[0],
+                ev.v[1],
+                ev.v[2],
+                ev.v[3]
+            ).Union();
+        default:
+            return 0;
+        }
+    }
 
-            fbb.Finish(envOffset);
+    void FieldWorker::post_event(std::uint64_t watcherId, std::uint32_t watcherSlot, const PendingEvent& ev,
+        net::SendClass cls, std::uint64_t key)
+    {
+        if (bundleEvents_ && queue_event(watcherId, watcherSlot, ev)) return;
 
-            sess->send_payload(
-                fbb.GetBufferPointer(),
-                static_cast<std::uint32_t>(fbb.GetSize())
-            );
-            });
+        auto sess = watcher_session(watcherId, watcherSlot);
+        if (!sess) return;
+
+        auto& fbb = encodeFbb_;
+        fbb.Clear();
+        auto evOffset = encode_event(fbb, ev);
+        fbb.Finish(field::CreateEnvelope(fbb, wire_kind(ev), evOffset));
+
+        sess->send_payload(
+            fbb.GetBufferPointer(),
+            static_cast<std::uint32_t>(fbb.GetSize()),
+            cls,
+            key
+        );
+    }
+
+    void FieldWorker::broadcast_event(const PendingEvent& ev, net::SendClass cls, std::uint64_t key)
+    {
+        if (!aoiSystem_) return;
+
+        if (bundleEvents_) {
+            aoiSystem_->for_each_watcher(ev.subjectId, [&](uint64_t watcherId, std::uint32_t watcherSlot) {
+                post_event(watcherId, watcherSlot, ev, cls, key);
+                });
+            return;
+        }
+
+        auto& fbb = encodeFbb_;
+        fbb.Clear();
+        auto evOffset = encode_event(fbb, ev);
+        fbb.Finish(field::CreateEnvelope(fbb, wire_kind(ev), evOffset));
+
+        broadcast_packet(ev.subjectId, fbb, cls, key);
+    }
+
+    bool FieldWorker::same_field_cmd(const PendingEvent& a, const PendingEvent& b)
+    {
+        return a.kind == b.kind && a.sub == b.sub && a.entityType == b.entityType
+            && a.subjectId == b.subjectId && a.x == b.x && a.y == b.y
+            && a.hasVel == b.hasVel && a.dirX == b.dirX && a.dirY == b.dirY && a.speed == b.speed;
+    }
+
+    void FieldWorker::post_aoi_event(std::uint64_t watcherId, std::uint32_t watcherSlot, const PendingEvent& ev,
+        net::SendClass cls)
+    {
+        if (bundleEvents_) {
+            post_event(watcherId, watcherSlot, ev, cls, ev.subjectId);
+            return;
+        }
+
+        auto sess = watcher_session(watcherId, watcherSlot);
+        if (!sess) return;
+
+        // AoiWorld 는 주체 하나의 이벤트를 watcher 목록 순서대로 연달아 낸다 -> 첫 watcher 에서만 인코딩
+        if (!aoiLastPkt_ || !same_field_cmd(aoiLastEv_, ev)) {
+            auto& fbb = encodeFbb_;
+            fbb.Clear();
+            auto evOffset = encode_event(fbb, ev);
+            fbb.Finish(field::CreateEnvelope(fbb, wire_kind(ev), evOffset));
+
+            aoiLastPkt_ = net::MakeSharedPacket(fbb.GetBufferPointer(), static_cast<std::uint32_t>(fbb.GetSize()));
+            if (!aoiLastPkt_) return;
+            aoiLastEv_ = ev;
+            aoiEncodes_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        sess->send_shared(aoiLastPkt_, cls, ev.subjectId);
+        aoiSends_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool FieldWorker::queue_event(std::uint64_t watcherId, std::uint32_t watcherSlot, const PendingEvent& ev)
+    {
+        // 칸을 모르는 watcher 는 묶지 않고 바로 보낸다 (드문 경로)
+        if (watcherSlot >= watcherSlots_.size()) return false;
+        WatcherSlot& w = watcherSlots_[watcherSlot];
+        if (w.playerId != watcherId) return false;
+
+        // 같은 주체의 Move 위치 / 스탯은 틱 안에서 최신 것만 (그 주체의 Enter/Leave 를 넘어서는 합치지 않음)
+        if (is_move(ev) || ev.kind == field::Packet::Packet_StatEvent) {
+            for (auto it = w.pending.rbegin(); it != w.pending.rend(); ++it) {
+                if (it->subjectId != ev.subjectId) continue;
+                if (it->kind == ev.kind && it->sub == ev.sub) {
+                    *it = ev;
+                    return true;
+                }
+                if (it->kind == field::Packet::Packet_FieldCmd) break;   // Enter/Leave
+            }
+        }
+
+        if (w.pending.empty()) dirtyWatchers_.push_back(watcherSlot);
+        w.pending.push_back(ev);
+        return true;
+    }
+
+    void FieldWorker::flush_bundles()
+    {
+        if (dirtyWatchers_.empty()) return;
+
+        auto& fbb = encodeFbb_;
+        auto& offsets = bundleOffsets_;
+        auto& types = bundleTypes_;
+
+        for (const std::uint32_t slot : dirtyWatchers_) {
+            if (slot >= watcherSlots_.size()) continue;
+            WatcherSlot& w = watcherSlots_[slot];
+            if (w.playerId == 0 || w.pending.empty()) continue;   // 그 사이 나갔거나 이미 보냄
+
+            auto sess = net::ResolveSession(w.session);
+            if (!sess) {
+                w.pending.clear();
+                continue;
+            }
+
+            fbb.Clear();
+            offsets.clear();
+            types.clear();
+            moveBatch_.clear();
+
+            // 압축 Move 는 모아 두었다가 MoveBatch 하나로. 모인 주체의 Enter/Leave 를 만나면 그 앞에서 끊는다
+            auto close_moves = [&] {
+                if (moveBatch_.empty()) return;
+                offsets.push_back(encode_move_batch(fbb, moveBatch_.data(), moveBatch_.size()));
+                types.push_back(static_cast<std::uint8_t>(field::Packet::Packet_MoveBatch));
+                moveBatch_.clear();
+            };
+
+            for (const auto& ev : w.pending) {
+                if (compactMoves_ && is_move(ev)) {
+                    moveBatch_.push_back(pack_move(ev));
+                    continue;
+                }
+                if (ev.kind == field::Packet::Packet_FieldCmd
+                    && std::any_of(moveBatch_.begin(), moveBatch_.end(),
+                        [&ev](const field::PackedMove& m) { return m.id() == ev.subjectId; })) {
+                    close_moves();
+                }
+                offsets.push_back(encode_event(fbb, ev));
+                types.push_back(static_cast<std::uint8_t>(wire_kind(ev)));
+            }
+            close_moves();
+
+            if (offsets.size() == 1) {
+                fbb.Finish(field::CreateEnvelope(fbb, static_cast<field::Packet>(types.front()), offsets.front()));
+            }
+            else {
+                auto bundle = field::CreateEventBundleDirect(fbb, &types, &offsets);
+                fbb.Finish(field::CreateEnvelope(fbb, field::Packet::Packet_EventBundle, bundle.Union()));
+            }
+
+            const auto size = static_cast<std::uint32_t>(fbb.GetSize());
+            sess->send_payload(fbb.GetBufferPointer(), size);
+
+            bundleFrames_.fetch_add(1, std::memory_order_relaxed);
+            bundledEvents_.fetch_add(w.pending.size(), std::memory_order_relaxed);
+            bundleBytes_.fetch_add(size, std::memory_order_relaxed);
+            w.pending.clear();
+        }
+        dirtyWatchers_.clear();
+    }
+
+    void FieldWorker::broadcast_ai_state(uint64_t entityId, field::EntityType et, field::AiStateType fbState)
+    {
+        PendingEvent ev;
+        ev.kind = field::Packet::Packet_AiStateEvent;
+        ev.entityType = static_cast<std::uint8_t>(et);
+        ev.subjectId = entityId;
+        ev.sub = static_cast<std::uint8_t>(fbState);
+
+        broadcast_event(ev);
     }
 
     void FieldWorker::broadcast_monster_ai_state(uint64_t monsterId, monster_ecs::CAI::State newState)
@@ -699,35 +1226,17 @@ namespace core {
 
     void FieldWorker::broadcast_stat_event(uint64_t entityId, field::EntityType et, int hp, int maxHp, int sp, int maxSp)
     {
-        aoiSystem_->for_each_watcher(entityId, [&](uint64_t watcherId) {
-            auto sess = net::SessionManager::instance().find_by_player_id(watcherId);
-            if (!sess) return;
-
-            flatbuffers::FlatBufferBuilder fbb;
-
-            auto evOffset = field::CreateStatEvent(
-                fbb,
-                et,
-                entityId,
-                hp,
-                maxHp,
-                sp,
-                maxSp
-            );
-
-            auto envOffset = field::CreateEnvelope(
-                fbb,
-                field::Packet::Packet_StatEvent,
-                evOffset.Union()
-            );
-
-            fbb.Finish(envOffset);
-
-            sess->send_payload(
-                fbb.GetBufferPointer(),
-                static_cast<std::uint32_t>(fbb.GetSize())
-            );
-            });
+        PendingEvent ev;
+        ev.kind = field::Packet::Packet_StatEvent;
+        ev.entityType = static_cast<std::uint8_t>(et);
+        ev.subjectId = entityId;
+        ev.v[0] = hp;
+        ev.v[1] = maxHp;
+        ev.v[2] = sp;
+        ev.v[3] = maxSp;
+
+        // 같은 주체의 스탯은 세션 큐에서 최신 것만 남는다 (공유 버퍼 참조만 교체)
+        broadcast_event(ev, net::SendClass::Stat, entityId);
     }
 
     void FieldWorker::broadcast_monster_stat(uint64_t monsterId, int hp, int maxHp, int sp, int maxSp)
@@ -792,35 +1301,9 @@ namespace core {
 
     void send_move_to_fieldworker(std::uint64_t playerId, int fieldId, float x, float y)
     {
-        flatbuffers::FlatBufferBuilder fbb;
-
-        auto pos = field::CreateVec2(fbb, x, y);
-
-        auto cmd = field::CreateFieldCmd(
-            fbb,
-            field::FieldCmdType::FieldCmdType_Move,
-            field::EntityType::EntityType_Player,
-            playerId,
-            pos,
-            0,
-            fbb.CreateString("")
-        );
-
-        auto envOffset = field::CreateEnvelope(
-            fbb,
-            field::Packet::Packet_FieldCmd,
-            cmd.Union()
-        );
-
-        fbb.Finish(envOffset);
-
         NetMessage msg;
-        msg.type = MessageType::Custom;
-        msg.session = nullptr;
-        msg.payload.assign(
-            fbb.GetBufferPointer(),
-            fbb.GetBufferPointer() + fbb.GetSize()
-        );
+        msg.type = MessageType::MoveField;
+        msg.cmd = MovePosData{ playerId, x, y };
 
         SendToFieldWorker(fieldId, std::move(msg));
     }
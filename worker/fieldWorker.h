@@ -2,6 +2,8 @@
 #pragma once
 #include <unordered_map>
 #include <cstdint>
+#include <atomic>
+#include <vector>
 #include "worker/worker.h"
 #include "game/player.h"
 #include "proto/generated/field_generated.h"
@@ -9,6 +11,7 @@
 #include "monster/MonsterWorld.h"
 #include "monster/Components.h"
 #include "field/monster/MonsterEnvironment.h"
+#include "field/MoveQuant.h"
 #include "storage/redis/redisUserCache.h"
 
 namespace storage { class DirtyHub; }
@@ -47,25 +50,48 @@ namespace core {
         using RedisRtWriter = std::function<void(const storage::redis::UserSnapshot&)>;
         
         void set_redis_rt_writer(RedisRtWriter fn) { redisRtWriter_ = std::move(fn); }
+        // 켜면 틱 동안 watcher 별로 필드 이벤트를 모았다가 틱 끝에 EventBundle 한 프레임으로 보낸다
+        //  (start() 전에 설정. 꺼져 있으면 이벤트마다 바로 보냄)
+        void set_bundle_events(bool on) { bundleEvents_ = on; }
+        // velocity=true: 이동을 방향/속도가 바뀔 때 + correctionSec 주기 보정 때만 보낸다 (클라 외삽)
+        void set_move_replication(bool velocity, float correctionSec) {
+            velocityRep_ = velocity;
+            moveCorrectionSec_ = correctionSec > 0.0f ? correctionSec : 1.0f;
+        }
+        // compact=true: Move 를 FieldCmd 대신 MoveBatch(양자화 PackedMove) 로 보낸다. precision: 위치 단위 (m)
+        //  - watcher 별로 틱 동안 모은 Move 를 MoveBatch 하나에 싣는다 (묶음 모드를 같이 켠다)
+        void set_move_encoding(bool compact, float precision);
         explicit FieldWorker(int fieldId, storage::DirtyHub& hub);
         ~FieldWorker();
 
+        // 필드 상태(players_, monsterWorld_, aoiSystem_)는 이 워커 스레드만 만진다
+        //  - 메시지 처리와 update_world 틱이 같은 루프에서 번갈아 돈다 (Worker::set_tick)
+        //  - 다른 스레드는 push() 로 메시지만 보낸다
         void handle_message(const NetMessage& msg);
+        // 메일박스 통계 + 스킬 지연 (I/O 스레드 수신 -> 필드 처리 시작)
+        void log_stats() const;
+        // bulk 레인 합치기 키: 본인 이동 입력이면 MoveCmdData 로 풀어 두고 playerId (type = MoveField)
+        std::uint64_t move_collapse_key(NetMessage& msg);
+        // 와이어 field::Envelope(FieldCmd Move) -> MoveCmdData. verify + 세션 본인 확인 포함
+        static bool decode_move_input(const NetMessage& msg, MoveCmdData& out);
+        // I/O 스레드가 라우트 테이블로 바로 넘긴 game::Envelope(SkillCmd) -> SkillCmdData. verify 는 여기서 1회
+        static bool decode_skill_input(const NetMessage& msg, SkillCmdData& out);
         static inline float clampf(float v, float lo, float hi) {
             return std::max(lo, std::min(v, hi));
         }
-        //  ƽ ȣ (dt:  )
+        // 워커 루프의 고정 스텝 틱에서 호출 (dt: 초 단위)
         void update_world(float dt);
         void tick_players(float step);
         void tick_monsters(float step);
-        // ÷̾ / (ʵ /  )
+        // 플레이어 등록/제거 (필드 입장/퇴장 시 사용)
         void add_player(Player::Ptr player);
         void remove_player(std::uint64_t playerId);
         void init_monster_env(); 
         int field_id() const { return fieldId_; }
-        void on_client_move_input(const field::FieldCmd& cmd, net::Session::Ptr session);
+        void on_client_move_input(const MoveCmdData& cmd);
+        void on_move_pos(const MovePosData& cmd);
         std::string get_prefab_name(uint64_t entityId, bool isMonster);
-        void send_field_enter(std::uint64_t watcherId, std::uint64_t subjectId, bool isMonster, const Vec2& pos);
+        void send_field_enter(std::uint64_t watcherId, std::uint32_t watcherSlot, std::uint64_t subjectId, bool isMonster, const Vec2& pos);
         void on_player_enter_field(Player::Ptr player);
         void mark_dirty_state(Player& player);
         void mark_dirty_pos_if_needed(Player& player,const Vec2& oldPos,const Vec2& newPos);
@@ -83,36 +109,144 @@ namespace core {
         void write_player_rt_enqueue(uint64_t playerId, const Player& p);
     private:
         int fieldId_{ 0 };    
-        float worldTime_ = 0.0f;  // ʵ   ð()
+        float worldTime_ = 0.0f;  // 필드 기준 누적 시간(초)
         monster_ecs::MonsterWorld monsterWorld_;
         monster_ecs::MonsterEnvironment env_;
         std::shared_ptr<FieldAoiSystem> aoiSystem_;
         // playerId -> Player
         std::unordered_map<std::uint64_t, Player::Ptr> players_;
+
+        // 필드 이벤트 한 건 (인코딩 전). 묶음 모드면 watcher 칸에 쌓였다가 틱 끝에 인코딩
+        struct PendingEvent {
+            field::Packet kind{ field::Packet::Packet_NONE };
+            std::uint8_t  sub{ 0 };          // FieldCmdType / AiStateType / CombatEvent 의 attackerType
+            std::uint8_t  entityType{ 0 };   // 주체 타입 (CombatEvent 는 targetType)
+            std::uint64_t subjectId{ 0 };    // 주체 (CombatEvent 는 targetId)
+            std::uint64_t otherId{ 0 };      // CombatEvent attackerId
+            float         x{ 0.0f }, y{ 0.0f };
+            std::int32_t  v[4]{};            // hp,maxHp,sp,maxSp / damage,remainHp
+            bool          hasVel{ false };   // FieldCmd dir/speed (속도 복제 모드)
+            float         dirX{ 0.0f }, dirY{ 0.0f }, speed{ 0.0f };
+        };
+
+        // 필드 로컬 watcher 칸: 칸 번호 -> (playerId, 세션 핸들)
+        //  - add_player 에서 채우고 remove_player 에서 비운다. 세션이 닫히면 핸들 세대가 바뀌어 resolve 가 nullptr
+        //  - AOI watcher 목록/Player 가 칸 번호를 들고 있어 브로드캐스트는 배열 인덱스로 바로 찾는다
+        struct WatcherSlot {
+            std::uint64_t      playerId{ 0 };   // 0 = 빈 칸
+            net::SessionHandle session{};
+            std::vector<PendingEvent> pending;  // 이번 틱에 쌓인 이벤트 (묶음 모드)
+        };
+        std::vector<WatcherSlot>   watcherSlots_;
+        std::vector<std::uint32_t> freeWatcherSlots_;
+        std::vector<std::uint32_t> dirtyWatchers_;   // pending 이 있는 칸 (틱 끝에 비움)
+        std::vector<flatbuffers::Offset<void>> bundleOffsets_;   // flush_bundles 에서 watcher 하나의 묶음 (재사용)
+        std::vector<std::uint8_t>              bundleTypes_;
+        bool bundleEvents_{ false };
+
+        // 묶음 통계 (log_stats 는 다른 스레드에서 읽는다)
+        std::atomic<std::uint64_t> bundleFrames_{ 0 };
+        std::atomic<std::uint64_t> bundledEvents_{ 0 };
+        std::atomic<std::uint64_t> bundleBytes_{ 0 };
+
+        // 속도 복제: 엔티티별 마지막으로 보낸 방향/속도
+        struct MoveRep {
+            float dirX{ 0.0f }, dirY{ 0.0f }, speed{ 0.0f };
+            float sentAt{ 0.0f };   // worldTime_
+        };
+        bool  velocityRep_{ false };
+        float moveCorrectionSec_{ 1.0f };
+        std::unordered_map<std::uint64_t, MoveRep> moveRep_;
+        std::atomic<std::uint64_t> moveSteps_{ 0 };   // 실제로 움직인 스텝 (위치 모드면 스텝마다 Move)
+        std::atomic<std::uint64_t> moveSends_{ 0 };   // 속도 모드에서 Move 를 낸 횟수
+
+        // 방향/속도가 바뀌었거나 보정 주기가 되면 Move 를 낸다 (틱 스텝 끝에서 호출)
+        void replicate_move(std::uint64_t id, float dirX, float dirY, float speed);
+        // 움직이던 엔티티가 죽거나 사라지거나 필드를 나갈 때 정지 상태를 한 번 낸다 (AOI 에서 빼기 전에 호출)
+        void replicate_stop(std::uint64_t id);
+
+        // 압축 이동 인코딩
+        static constexpr float kAoiSectorSize = 15.0f;
+        bool          compactMoves_{ false };
+        field::MoveQuantizer moveQuant_{ kAoiSectorSize, 0.01f };
+        std::vector<field::PackedMove> moveBatch_;   // flush_bundles 에서 watcher 하나의 Move 모음 (재사용)
+        // 이동 페이로드 바이트 (Envelope/프레임 헤더 제외). 플레이어당 초당 대역폭으로 FieldCmd 와 비교
+        std::atomic<std::uint64_t> moveMsgs_{ 0 };
+        std::atomic<std::uint64_t> moveMsgBytes_{ 0 };
+        std::atomic<std::size_t>   playerCount_{ 0 };
+        mutable std::chrono::steady_clock::time_point statsLastTime_{ std::chrono::steady_clock::now() };
+        mutable std::uint64_t statsLastMoveBytes_{ 0 };
+
+        // 이벤트가 실제로 실릴 union 타입 (압축 모드의 Move 는 MoveBatch)
+        field::Packet wire_kind(const PendingEvent& ev) const;
+        static bool is_move(const PendingEvent& ev) {
+            return ev.kind == field::Packet::Packet_FieldCmd
+                && ev.sub == static_cast<std::uint8_t>(field::FieldCmdType::FieldCmdType_Move);
+        }
+        field::PackedMove pack_move(const PendingEvent& ev) const;
+        flatbuffers::Offset<void> encode_move_batch(flatbuffers::FlatBufferBuilder& fbb,
+            const field::PackedMove* moves, std::size_t count);
+        // 마지막으로 보낸 방향/속도를 이벤트에 싣는다 (Enter/Snapshot 도 외삽 시작점이 되도록)
+        void fill_velocity(PendingEvent& ev) const;
+
+        // 칸이 playerId 것이면 그 세션, 칸을 모르면 전역 디렉터리로 (드문 경로)
+        net::Session* watcher_session(std::uint64_t playerId, std::uint32_t slot) const;
         float playerAcc_ = 0.0f;
         float monsterAcc_ = 0.0f;
 
         static constexpr float PlayerStep = 0.05f;  // 50ms
         static constexpr float MonsterStep = 0.10f;  // 100ms
+        static constexpr std::chrono::milliseconds TickPeriod{ 50 };   // = PlayerStep
+        static constexpr std::size_t TickDrainBudget = 512;           // 틱 사이 한 번에 처리할 최대 메시지
 
-        storage::DirtyHub& dirtyHub_;// Ƽ ó
+        storage::DirtyHub& dirtyHub_;//레디스 더티 처리
         float posDirtyDist_ = 0.10f;      // 10cm
-        float dirtyMinInterval_ = 0.25f;  // 250ms ()
+        float dirtyMinInterval_ = 0.25f;  // 250ms (선택)
         RedisRtWriter redisRtWriter_;             
         storage::redis::UserSnapshot scratchSnap_{}; 
+        TickHistogram skillLatency_;
+
+        // 이벤트 인코딩용 (필드 스레드 전용, Clear() 후 재사용)
+        flatbuffers::FlatBufferBuilder encodeFbb_{ 256 };
+        // fbb 내용을 한 번 프레이밍해 subjectId 의 watcher 전원에게 같은 버퍼로 보낸다
+        void broadcast_packet(std::uint64_t subjectId, flatbuffers::FlatBufferBuilder& fbb,
+            net::SendClass cls = net::SendClass::Reliable, std::uint64_t key = 0);
+
+        flatbuffers::Offset<void> encode_event(flatbuffers::FlatBufferBuilder& fbb, const PendingEvent& ev);
+        flatbuffers::Offset<void> encode_event_body(flatbuffers::FlatBufferBuilder& fbb, const PendingEvent& ev);
+        // watcher 한 명에게: 묶음 모드면 칸에 쌓고, 아니면 바로 Envelope 로 보낸다
+        void post_event(std::uint64_t watcherId, std::uint32_t watcherSlot, const PendingEvent& ev,
+            net::SendClass cls = net::SendClass::Reliable, std::uint64_t key = 0);
+        // subjectId 의 watcher 전원에게 (묶음 모드가 아니면 인코딩 1회 공유 버퍼)
+        void broadcast_event(const PendingEvent& ev,
+            net::SendClass cls = net::SendClass::Reliable, std::uint64_t key = 0);
+        // AOI Enter/Leave/Move: 같은 이벤트가 watcher 마다 연달아 오므로 직전 것과 같으면 그 공유 버퍼를 다시 쓴다
+        //  (묶음 모드면 post_event 로 칸에 쌓는다)
+        void post_aoi_event(std::uint64_t watcherId, std::uint32_t watcherSlot, const PendingEvent& ev, net::SendClass cls);
+        static bool same_field_cmd(const PendingEvent& a, const PendingEvent& b);
+        PendingEvent      aoiLastEv_;
+        net::SharedPacket aoiLastPkt_;   // 틱 끝에 놓는다
+        std::atomic<std::uint64_t> aoiEncodes_{ 0 };   // AOI 이벤트 인코딩 수
+        std::atomic<std::uint64_t> aoiSends_{ 0 };     // AOI 이벤트 watcher 송신 수
+        bool queue_event(std::uint64_t watcherId, std::uint32_t watcherSlot, const PendingEvent& ev);
+        // 틱 끝: 칸마다 쌓인 이벤트를 EventBundle 한 프레임으로 (1건이면 그냥 Envelope)
+        //  - 압축 모드면 그 칸의 Move 는 MoveBatch 하나로 모은다
+        void flush_bundles();
     private:        
-        void send_combat_event(field::EntityType attackerType,uint64_t  attackerId, field::EntityType targetType, uint64_t targetId,int damage,int remainHp);
-        void send_stat_event(std::uint64_t watcherId, std::uint64_t subjectId, bool isMonster, int hp, int maxHp, int sp, int maxSp);
+        void send_combat_event(field::EntityType attackerType,uint64_t  attackerId, field::EntityType targetType, uint64_t targetId, std::uint32_t targetSlot,int damage,int remainHp);
+        void send_stat_event(std::uint64_t watcherId, std::uint32_t watcherSlot, std::uint64_t subjectId, bool isMonster, int hp, int maxHp, int sp, int maxSp);
         void monster_spawn_in_aoi(std::uint64_t monsterId, float x, float y);
         void monster_remove_from_aoi(std::uint64_t monsterId);
-        void handle_skill(const NetMessage& msg);
+        void handle_skill(net::SessionHandle session, const SkillCmdData& skill);
+        void handle_enter_field(const NetMessage& msg);
+        void handle_leave_field(const NetMessage& msg);
     };
 
-    // WorkerManager      
+    // WorkerManager 관련 헬퍼    
     std::shared_ptr<core::FieldWorker> GetFieldWorker(int fieldId);
     bool SendToFieldWorker(int fieldId, NetMessage msg);
 
-    // (ɼ) Ŭ ǥ Move ʵĿ  
+    // (옵션) 클라 절대좌표 Move를 필드워커로 보내는 헬퍼
     void send_move_to_fieldworker(std::uint64_t playerId, int fieldId, float x, float y);
 
 } // namespace core
\ No newline at end of file
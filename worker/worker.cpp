@@ -1,13 +1,31 @@
 #include "worker.h"
+
+#include <algorithm>
+
 #include "workerManager.h"
+#include "core/log.h"
+#include "field/FieldScheduler.h"
+#include "net/session_epoch.h"
 
 namespace core {
 
-    // ================ Worker  ================
+    // ================ Worker 구현 ================
+
+    namespace {
+        thread_local std::chrono::steady_clock::time_point t_enqueuedAt{};
+    }
+
+    std::chrono::steady_clock::time_point Worker::current_enqueued_at() {
+        return t_enqueuedAt;
+    }
 
-    Worker::Worker(std::string name)
+    Worker::Worker(std::string name, std::size_t mailboxCapacity)
         : name_(std::move(name))
+        , mailbox_(mailboxCapacity)
+        , bulk_(mailboxCapacity)
     {
+        bulkBatch_.reserve(kBulkQuantum);
+        bulkKeys_.reserve(kBulkQuantum);
     }
 
     Worker::~Worker() {
@@ -21,6 +39,16 @@ namespace core {
             return;
         }
 
+        ticking_ = on_tick_ && tickPeriod_.count() > 0;
+        if (ticking_) {
+            nextTick_ = std::chrono::steady_clock::now() + tickPeriod_;
+        }
+
+        if (scheduler_) {
+            scheduler_->attach(this);
+            return;
+        }
+
         thread_ = std::thread([this] {
             this->loop();
             });
@@ -33,11 +61,15 @@ namespace core {
             return;
         }
 
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-
+        if (scheduler_) {
+            // 풀 스레드가 실행 중이면 끝날 때까지 기다린 뒤 빠진다. 이후 소유자는 호출 스레드
+            scheduler_->detach(this);
+            net::SessionReader reader;
+            run_slice(SIZE_MAX);
+            return;
         }
-        cv_.notify_all();
+
+        wake();
 
         if (thread_.joinable()) {
             thread_.join();
@@ -45,72 +77,503 @@ namespace core {
     }
 
     void Worker::set_on_message(Callback cb) {
+        if (running_.load(std::memory_order_acquire)) {
+            LOG_WARN("[Worker] {} set_on_message after start ignored", name_);
+            return;
+        }
         on_message_ = std::move(cb);
     }
 
+    // 가득 차면 kPushRetries 번까지만 양보하며 재시도
+    bool Worker::try_push_lane(MpscQueue<NetMessage>& lane, NetMessage& msg) {
+        if (lane.try_push(std::move(msg))) return true;
+
+        fullWaits_.fetch_add(1, std::memory_order_relaxed);
+        for (int i = 0; i < kPushRetries; ++i) {
+            std::this_thread::yield();
+            if (lane.try_push(std::move(msg))) return true;
+        }
+        return false;
+    }
+
+    void Worker::push_overflow(NetMessage&& msg) {
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        overflow_.push_back(std::move(msg));
+        hasOverflow_.store(true, std::memory_order_release);
+    }
+
+    // 세션별로 순서대로 쌓되 이어진 이동 입력은 최신 것으로 덮는다. 세션이 없는 입력은 false (control overflow 로)
+    bool Worker::push_bulk_spill(NetMessage&& msg) {
+        if (!msg.session.valid()) return false;
+
+        const std::uint64_t key = (static_cast<std::uint64_t>(msg.session.index) << 32) | msg.session.gen;
+        std::lock_guard<std::mutex> lock(bulkSpillMutex_);
+        auto& q = bulkSpill_[key];
+        if (LaneOf(msg) == Lane::Bulk && !q.empty() && LaneOf(q.back()) == Lane::Bulk) {
+            q.back() = std::move(msg);
+        }
+        else {
+            q.push_back(std::move(msg));
+        }
+        hasBulkSpill_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    // 같은 세션 칸에 남은 메시지가 있는 레인을 따른다 (bulk 우선: 이미 bulk 에 있으면 control 도 그 뒤로)
+    Worker::Lane Worker::route_lane(const NetMessage& msg) {
+        const Lane natural = LaneOf(msg);
+        if (!msg.session.valid()) return natural;
+
+        const std::size_t b = msg.session.index & (kOrderBuckets - 1);
+        Lane lane = natural;
+        if (pendingBulk_[b].load(std::memory_order_acquire) > 0) lane = Lane::Bulk;
+        else if (pendingControl_[b].load(std::memory_order_acquire) > 0) lane = Lane::Control;
+
+        (lane == Lane::Bulk ? pendingBulk_ : pendingControl_)[b].fetch_add(1, std::memory_order_acq_rel);
+        return lane;
+    }
+
+    // 처리가 끝난 뒤에 내린다 (처리 중인 것도 남은 것으로 본다)
+    void Worker::order_done(const NetMessage& msg, Lane lane) {
+        if (!msg.session.valid()) return;
+        const std::size_t b = msg.session.index & (kOrderBuckets - 1);
+        (lane == Lane::Bulk ? pendingBulk_ : pendingControl_)[b].fetch_sub(1, std::memory_order_acq_rel);
+    }
+
     void Worker::push(NetMessage msg) {
+        if (LaneOf(msg) == Lane::Control) {
+            msg.enqueuedAt = std::chrono::steady_clock::now();
+        }
+
+        if (route_lane(msg) == Lane::Bulk) {
+            // 이동 입력은 다음 입력이 덮으므로 계속 가득 차 있으면 세션별 최신 것만 남긴다 (버리지 않는다)
+            // spill 이 남아 있으면 레인에 넣지 않는다 (레인에 있는 것이 spill 보다 새것이 되지 않게)
+            if (hasBulkSpill_.load(std::memory_order_acquire) || !try_push_lane(bulk_, msg)) {
+                bulkSpilled_.fetch_add(1, std::memory_order_relaxed);
+                if (!push_bulk_spill(std::move(msg))) {
+                    overflowed_.fetch_add(1, std::memory_order_relaxed);
+                    push_overflow(std::move(msg));
+                }
+            }
+        }
+        else {
+            if (LaneOf(msg) == Lane::Bulk) msg.enqueuedAt = std::chrono::steady_clock::now();
+
+            // control 은 버리지 않는다. overflow 가 남아 있으면 순서를 지키려 뒤에 붙인다
+            if (hasOverflow_.load(std::memory_order_acquire) || !try_push_lane(mailbox_, msg)) {
+                overflowed_.fetch_add(1, std::memory_order_relaxed);
+                push_overflow(std::move(msg));
+            }
+        }
+
+        // park_until() 의 fence 와 짝: 넣은 뒤에 parked_ 를 봐야 잠들기 직전 push 를 놓치지 않는다
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (scheduler_) {
+            scheduler_->notify(this);
+            return;
+        }
+
+        if (parked_.load(std::memory_order_relaxed)) {
+            wake();
+        }
+    }
+
+    void Worker::set_tick(std::chrono::microseconds period, TickCallback cb, std::size_t drainBudget) {
+        tickPeriod_ = period;
+        on_tick_ = std::move(cb);
+        drainBudget_ = drainBudget ? drainBudget : 1;
+    }
+
+    void Worker::set_tick_policy(const config::TickConfig& cfg) {
+        tickSkipLate_ = cfg.policy == "skip";
+        tickMaxCatchUp_ = std::max(0, cfg.max_catch_up);
+        tickSpinMargin_ = std::chrono::microseconds(std::max(0, cfg.spin_margin_us));
+    }
+
+    void Worker::wake() {
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            queue_.push(std::move(msg));
-        } 
-        cv_.notify_one();
+            std::lock_guard<std::mutex> lock(parkMutex_);
+            ++wakeEpoch_;
+        }
+        parkCv_.notify_one();
     }
 
-    void Worker::loop() {
-        while (running_.load()) {
-            NetMessage msg;
+    // deadline == time_point::max() 면 메시지가 올 때까지 잔다
+    void Worker::park_until(std::chrono::steady_clock::time_point deadline) {
+        using clock = std::chrono::steady_clock;
+
+        const bool timed = deadline != clock::time_point::max();
+        const clock::time_point wakeAt = timed ? deadline - tickSpinMargin_ : deadline;
+
+        if (!timed || clock::now() < wakeAt) {
+            std::unique_lock<std::mutex> lock(parkMutex_);
+            const std::uint32_t epoch = wakeEpoch_;
 
-            {
-                std::unique_lock<std::mutex> lock(mutex_);
-                cv_.wait(lock, [&] {
-                    return !running_.load() || !queue_.empty();
-                    });
+            parked_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
 
-                if (!running_.load() && queue_.empty())
-                    break;
+            if (mailbox_empty() && running_.load(std::memory_order_acquire)) {
+                parks_.store(parks_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 
-                msg = std::move(queue_.front());
-                queue_.pop();
+                auto pred = [&] { return wakeEpoch_ != epoch || !running_.load(std::memory_order_acquire); };
+                net::SessionEpoch::offline();   // 자는 동안은 세션 회수를 막지 않는다
+                if (timed) parkCv_.wait_until(lock, wakeAt, pred);
+                else       parkCv_.wait(lock, pred);
+                net::SessionEpoch::online();
             }
 
-            if (on_message_) {
-                on_message_(msg);
+            parked_.store(false, std::memory_order_relaxed);
+        }
+
+        // 마감 직전 짧은 구간은 양보 spin (메시지가 오면 바로 빠져나간다)
+        while (timed && clock::now() < deadline
+            && mailbox_empty() && running_.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // 틱 1회. 마감은 절대 시각으로 이어 붙인다 (next += period)
+    // 끝났을 때 다음 마감도 이미 지났으면 정책대로 바로 따라잡거나 밀린 마감을 버린다
+    void Worker::run_tick(std::chrono::steady_clock::time_point now, std::int64_t lateUs) {
+        using clock = std::chrono::steady_clock;
+        using us = std::chrono::microseconds;
+
+        tickLate_.record(lateUs);
+
+        const float dt = std::chrono::duration<float>(tickPeriod_).count();
+        on_tick_(dt);
+
+        const auto end = clock::now();
+        const auto spent = end - now;
+        tickOverrun_.record(spent > tickPeriod_ ? std::chrono::duration_cast<us>(spent - tickPeriod_).count() : 0);
+
+        nextTick_ += tickPeriod_;
+        ticks_.store(ticks_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (end <= nextTick_) {
+            tickCatchUpRun_ = 0;
+            return;
+        }
+
+        // max_catch_up 은 밀린 구간 전체에 건다: 틱마다 새로 재면 틱이 주기보다 길 때 영영 따라잡기만 한다
+        const auto missed = (end - nextTick_) / tickPeriod_ + 1;
+        if (tickSkipLate_ || tickCatchUpRun_ + missed > tickMaxCatchUp_) {
+            nextTick_ += tickPeriod_ * missed;
+            ticksSkipped_.fetch_add(static_cast<std::uint64_t>(missed), std::memory_order_relaxed);
+            tickCatchUpRun_ = 0;
+        }
+        else {
+            ++tickCatchUpRun_;
+            ticksCaughtUp_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // overflow 를 통째로 가져와 전부 처리한다 (가져온 뒤 오는 control 은 메일박스로 가므로 여기서 끝까지 비워야 순서가 맞다)
+    std::size_t Worker::drain_overflow() {
+        if (!hasOverflow_.load(std::memory_order_acquire)) return 0;
+        {
+            std::lock_guard<std::mutex> lock(overflowMutex_);
+            // 락 안에서 다시 본다: 레인을 비운 뒤 같은 생산자가 레인에 넣고 overflow 에 넣었으면 레인 것이 먼저
+            if (!mailbox_.empty_approx()) return 0;
+            overflowBatch_.swap(overflow_);
+            hasOverflow_.store(false, std::memory_order_release);
+        }
+
+        const std::size_t n = overflowBatch_.size();
+        for (auto& msg : overflowBatch_) {
+            deliver_control(msg);
+            order_done(msg, Lane::Control);
+        }
+        overflowBatch_.clear();
+        return n;
+    }
+
+    // spill 을 통째로 가져와 처리한다 (bulk 레인을 다 비운 뒤에만 호출)
+    std::size_t Worker::drain_bulk_spill() {
+        if (!hasBulkSpill_.load(std::memory_order_acquire)) return 0;
+        {
+            std::lock_guard<std::mutex> lock(bulkSpillMutex_);
+            if (!bulk_.empty_approx()) return 0;   // drain_overflow 와 같은 이유
+            for (auto& [key, q] : bulkSpill_) {
+                for (auto& msg : q) bulkSpillBatch_.push_back(std::move(msg));
+            }
+            bulkSpill_.clear();
+            hasBulkSpill_.store(false, std::memory_order_release);
+        }
+
+        const std::size_t n = bulkSpillBatch_.size();
+        for (auto& msg : bulkSpillBatch_) {
+            deliver_bulk(msg);
+            order_done(msg, Lane::Bulk);
+        }
+        bulkSpillBatch_.clear();
+        return n;
+    }
+
+    bool Worker::set_affinity(const CoreSet& cores) {
+        if (scheduler_ || !thread_.joinable()) return false;
+        return PinThread(thread_.native_handle(), cores);
+    }
+
+    void Worker::deliver(NetMessage& msg) {
+        if (on_message_) {
+            on_message_(msg);
+        }
+    }
+
+    void Worker::deliver_control(NetMessage& msg) {
+        const auto waitUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - msg.enqueuedAt).count();
+        controlWait_.record(waitUs);
+        t_enqueuedAt = msg.enqueuedAt;
+        deliver(msg);
+    }
+
+    // 세션 순서 때문에 bulk 로 온 control 은 control 처럼 처리 (대기 시간 포함)
+    void Worker::deliver_bulk(NetMessage& msg) {
+        if (LaneOf(msg) == Lane::Control) deliver_control(msg);
+        else                              deliver(msg);
+    }
+
+    // bulk 한 묶음: 꺼낸 것 중 같은 키는 마지막 것만 처리 (순서는 그대로)
+    //  - 사이에 낀 control 은 경계: 그 앞의 이동을 뒤의 이동으로 덮지 않는다
+    std::size_t Worker::drain_bulk(std::size_t maxCount) {
+        bulkBatch_.clear();
+        bulk_.drain([this](NetMessage&& msg) {
+            bulkBatch_.push_back(std::move(msg));
+            }, maxCount);
+
+        const std::size_t n = bulkBatch_.size();
+        if (n == 0) return 0;
+
+        if (!collapse_key_ || n == 1) {
+            for (auto& msg : bulkBatch_) {
+                deliver_bulk(msg);
+                order_done(msg, Lane::Bulk);
+            }
+            bulkBatch_.clear();
+            return n;
+        }
+
+        bulkKeys_.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            NetMessage& msg = bulkBatch_[i];
+            bulkKeys_[i] = LaneOf(msg) == Lane::Control ? 0 : collapse_key_(msg);
+        }
+
+        // 뒤에서부터 보며 이미 본 키면 버릴 표시 (UINT64_MAX). control 을 지나면 본 키를 잊는다
+        std::uint64_t dropped = 0;
+        bulkSeen_.clear();
+        for (std::size_t i = n; i-- > 0;) {
+            if (LaneOf(bulkBatch_[i]) == Lane::Control) {
+                bulkSeen_.clear();
+                continue;
+            }
+            const std::uint64_t key = bulkKeys_[i];
+            if (key == 0) continue;
+            if (!bulkSeen_.insert(key).second) {
+                bulkKeys_[i] = UINT64_MAX;
+                ++dropped;
+            }
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (bulkKeys_[i] != UINT64_MAX) deliver_bulk(bulkBatch_[i]);
+            order_done(bulkBatch_[i], Lane::Bulk);
+        }
+        bulkBatch_.clear();
+
+        if (dropped) {
+            collapsed_.store(collapsed_.load(std::memory_order_relaxed) + dropped, std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    std::size_t Worker::drain_lanes(std::size_t budget) {
+        std::size_t n = 0;
+        while (n < budget) {
+            const std::size_t quantum = std::min(kControlQuantum, budget - n);
+            std::size_t c = mailbox_.drain([this](NetMessage&& msg) {
+                deliver_control(msg);
+                order_done(msg, Lane::Control);
+                }, quantum);
+            // 메일박스 앞부분을 다 비웠을 때만 overflow (overflow 는 메일박스가 찬 뒤에 들어온 것)
+            if (c < quantum) c += drain_overflow();
+            n += c;
+            if (n >= budget) break;
+
+            const std::size_t bq = std::min(kBulkQuantum, budget - n);
+            std::size_t b = drain_bulk(bq);
+            // bulk 레인을 다 비웠을 때만 spill (spill 은 레인이 찬 뒤에 들어온 더 새것)
+            if (b < bq) b += drain_bulk_spill();
+            n += b;
+
+            if (c == 0 && b == 0) break;
+        }
+        return n;
+    }
+
+    Worker::Slice Worker::run_slice(std::size_t budget) {
+        Slice r;
+
+        if (!startedOnThread_ && running_.load(std::memory_order_acquire)) {
+            startedOnThread_ = true;
+            if (on_start_) on_start_();
+        }
+
+        // 쌓인 만큼 한 번에 처리 (메시지마다 락/notify 없음). 틱 워커는 budget 까지만
+        r.drained = drain_lanes(budget);
+
+        if (r.drained > 0) {
+            drained_.store(drained_.load(std::memory_order_relaxed) + r.drained, std::memory_order_relaxed);
+            batches_.store(batches_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        if (ticking_ && running_.load(std::memory_order_acquire)) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= nextTick_) {
+                r.tickLateUs = std::chrono::duration_cast<std::chrono::microseconds>(now - nextTick_).count();
+                run_tick(now, r.tickLateUs);
+                r.ticked = true;
+            }
+        }
+        return r;
+    }
+
+    void Worker::loop() {
+        using clock = std::chrono::steady_clock;
+
+        net::SessionReader reader;   // 이 스레드가 resolve 한 세션 포인터의 회수 시점 (QSBR)
+
+        for (;;) {
+            const Slice r = run_slice(ticking_ ? drainBudget_ : SIZE_MAX);
+            net::SessionEpoch::quiescent();   // 조각 사이: 세션 포인터를 들고 있지 않다
+
+            if (!running_.load(std::memory_order_acquire)) {
+                if (r.drained > 0) continue;   // 남은 메시지는 마저 처리하고 끝낸다
+                break;
             }
+
+            if (r.drained > 0 || r.ticked) continue;
+
+            park_until(ticking_ ? nextTick_ : clock::time_point::max());
         }
     }
 
-    INT32 Worker::GetMessageCount()
+    INT32 Worker::GetMessageCount() const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return static_cast<INT32>(queue_.size());
+        return static_cast<INT32>(mailbox_.size_approx() + bulk_.size_approx());
     }
 
-    // ================ GameWorker   ================
+    Worker::MailboxStats Worker::mailbox_stats() const {
+        MailboxStats st;
+        st.drained = drained_.load(std::memory_order_relaxed);
+        st.batches = batches_.load(std::memory_order_relaxed);
+        st.parks = parks_.load(std::memory_order_relaxed);
+        st.full_waits = fullWaits_.load(std::memory_order_relaxed);
+        st.bulk_spilled = bulkSpilled_.load(std::memory_order_relaxed);
+        st.overflowed = overflowed_.load(std::memory_order_relaxed);
+        st.ticks = ticks_.load(std::memory_order_relaxed);
+        st.ticks_skipped = ticksSkipped_.load(std::memory_order_relaxed);
+        st.ticks_caught_up = ticksCaughtUp_.load(std::memory_order_relaxed);
+        st.collapsed = collapsed_.load(std::memory_order_relaxed);
+        return st;
+    }
+
+    void Worker::log_mailbox_stats() const {
+        const MailboxStats st = mailbox_stats();
+        LOG_INFO("[Worker] {} queued={} drained={} msgs/batch={} parks={} full_waits={} ticks={} ticks_skipped={}",
+            name_, GetMessageCount(), st.drained,
+            st.batches ? double(st.drained) / double(st.batches) : 0.0,
+            st.parks, st.full_waits, st.ticks, st.ticks_skipped);
+        LOG_INFO("[Worker] {} bulk_queued={} collapsed={} bulk_spilled={} overflowed={} control_wait_us p50<={} p99<={} max={}",
+            name_, bulk_.size_approx(), st.collapsed, st.bulk_spilled, st.overflowed,
+            controlWait_.percentile_us(0.50), controlWait_.percentile_us(0.99), controlWait_.max_us());
+        if (!ticking_) return;
+        LOG_INFO("[Worker] {} caught_up={} tick_late_us p50<={} p99<={} max={} | overrun_us p99<={} max={}",
+            name_, st.ticks_caught_up,
+            tickLate_.percentile_us(0.50), tickLate_.percentile_us(0.99), tickLate_.max_us(),
+            tickOverrun_.percentile_us(0.99), tickOverrun_.max_us());
+    }
+
+    // ================ GameWorker 헬퍼 구현 ================
+
+    namespace {
+        // CreateGameWorkers 에서만 채운다 (서버 시작 전). 이후 I/O 스레드는 읽기만
+        std::vector<Worker::Ptr> g_gameShards;
+    }
 
     Worker::Ptr GetGameWorker() {
         return WorkerManager::instance().get(GAME_WORKER_NAME);
     }
 
-    bool CreateGameWorker() {
-        auto& mgr = WorkerManager::instance();
-        auto existing = mgr.get(GAME_WORKER_NAME);
-        if (existing) return true;
+    Worker* GameWorkerFor(std::uint64_t sessionId) {
+        if (g_gameShards.empty()) return nullptr;
+        return g_gameShards[sessionId % g_gameShards.size()].get();
+    }
 
-        auto worker = std::make_shared<Worker>(GAME_WORKER_NAME);
-        if (!worker) return false;
+    int GameWorkerCount() {
+        return static_cast<int>(g_gameShards.size());
+    }
 
-        if (!mgr.insert(GAME_WORKER_NAME, worker))
+    bool CreateGameWorker(Worker::Callback onMessage, const CoreSet& cores) {
+        return CreateGameWorkers(1, std::move(onMessage), cores);
+    }
+
+    bool CreateGameWorkers(int shards, Worker::Callback onMessage, const CoreSet& cores) {
+        if (!g_gameShards.empty()) return true;
+        if (!onMessage) {
+            LOG_WARN("[GameWorker] on_message handler is required before start");
             return false;
+        }
+        if (shards <= 0) shards = 1;
+
+        auto& mgr = WorkerManager::instance();
 
-        worker->start();
+        std::vector<Worker::Ptr> created;
+        std::vector<std::string> names;
+        for (int i = 0; i < shards; ++i) {
+            const std::string name = i == 0
+                ? std::string(GAME_WORKER_NAME)
+                : std::string(GAME_WORKER_NAME) + "#" + std::to_string(i);
+
+            auto worker = std::make_shared<Worker>(name);
+            worker->set_on_message(onMessage);
+
+            if (!mgr.insert(name, worker)) {
+                // 일부만 떠 있는 샤드 구성은 남기지 않는다 (세션 ID % 샤드 수 배정이 어긋난다)
+                LOG_ERROR("[GameWorker] register {} failed, rolling back {} shards", name, created.size());
+                for (auto& w : created) w->stop();
+                for (auto& n : names) mgr.remove(n);
+                return false;
+            }
+
+            worker->start();
+            worker->set_affinity(cores.pick(i, shards));
+            created.push_back(worker);
+            names.push_back(name);
+        }
+        g_gameShards = std::move(created);
+
+        LOG_INFO("[GameWorker] shards={} cores={}", shards, cores.to_string());
         return true;
     }
 
-    bool SendToGameWorker(NetMessage msg) {
-        auto worker = GetGameWorker();
+    bool SendToGameWorker(std::uint64_t sessionId, NetMessage msg) {
+        Worker* worker = GameWorkerFor(sessionId);
         if (!worker) return false;
         worker->push(std::move(msg));
         return true;
     }
 
+    // 샤드별 처리량/적체. 샤드 수(game.worker_shards)를 바꿔가며 로그인 폭주 때 비교
+    void LogGameWorkerStats() {
+        std::uint64_t total = 0;
+        for (const auto& w : g_gameShards) {
+            w->log_mailbox_stats();
+            total += w->mailbox_stats().drained;
+        }
+        LOG_INFO("[GameWorker] shards={} drained_total={}", g_gameShards.size(), total);
+    }
+
 } // namespace core
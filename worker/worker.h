@@ -1,17 +1,26 @@
 #pragma once
 
 #include <thread>
+#include <array>
 #include <mutex>
 #include <condition_variable>
-#include <queue>
+#include <chrono>
+#include <deque>
 #include <unordered_map>
+#include <unordered_set>
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
 #include <vector>
+#include <variant>
 #include <cstdint>
 #include "core/core_types.h"
+#include "core/mpsc_queue.h"
+#include "core/affinity.h"
+#include "core/tick_histogram.h"
+#include "config/server_config.h"   // TickConfig
+#include "net/session_handle.h"
 
 namespace net {
     class Session; 
@@ -19,44 +28,159 @@ namespace net {
 
 namespace core {
 
+    class FieldScheduler;
    
     enum class MessageType : uint8_t {
-        NetEnvelope = 0,   // Ʈũ Ŷ(FlatBuffers Envelope)
-        Custom = 1,   // Ÿ 뵵
-        EnterField = 2,   // ʵ 
-        LeaveField = 3,   // ʵ 
-        MoveField = 4,   // ʵ  ̵
-		SkillCmd = 5,   // ų Ŀǵ
+        NetEnvelope = 0,   // 네트워크 패킷(FlatBuffers Envelope)
+        Custom = 1,   // 기타 용도
+        EnterField = 2,   // 필드 입장
+        LeaveField = 3,   // 필드 퇴장
+        MoveField = 4,   // 필드 내 이동
+		SkillCmd = 5,   // 스킬 커맨드
     };
 
-  
+    // 워커 사이 내부 명령 (POD). 직렬화/verify/힙 할당 없이 NetMessage 에 그대로 실린다
+    //  - 와이어 FlatBuffers 는 네트워크 경계(받은 패킷 payload, 보내는 패킷)에만 쓴다
+    struct SkillCmdData {
+        std::int8_t   skill{ 0 };      // game::SkillType
+        std::uint64_t targetId{ 0 };
+        std::chrono::steady_clock::time_point recvAt{};   // I/O 스레드가 워커로 넘긴 시각 (지연 측정)
+    };
+
+    // 이동 입력 (세션 본인 확인 끝난 것). dir 이 0 이면 정지
+    struct MoveCmdData {
+        std::uint64_t playerId{ 0 };
+        float         dirX{ 0.f };
+        float         dirY{ 0.f };
+    };
+
+    // 필드 퇴장 대상 (세션이 이미 닫힌 뒤 처리될 수 있어 playerId 를 같이 싣는다)
+    struct PlayerRefData {
+        std::uint64_t playerId{ 0 };
+    };
+
+    // 필드 입장: 필드/시작 좌표는 필드 워커가 Player 에 쓴다 (GameWorker 에서 쓰면 이전 필드 워커와 경합)
+    struct EnterFieldData {
+        std::uint64_t playerId{ 0 };
+        std::uint32_t fieldId{ 0 };
+        float         x{ 0.f };
+        float         y{ 0.f };
+    };
+
+    // 서버가 정한 절대 좌표로 옮기기
+    struct MovePosData {
+        std::uint64_t playerId{ 0 };
+        float         x{ 0.f };
+        float         y{ 0.f };
+    };
+
+    using InternalCmd = std::variant<std::monostate, SkillCmdData, MoveCmdData, MovePosData, PlayerRefData, EnterFieldData>;
+
     struct NetMessage {
         MessageType                      type{ MessageType::NetEnvelope };
-        std::shared_ptr<net::Session>    session;   //  
-        std::vector<uint8_t>             payload;   
+        net::SessionHandle               session;   // 보낸 세션 (net::ResolveSession 으로 꺼낸다. 닫혔으면 nullptr)
+        std::vector<uint8_t>             payload;   // 와이어 패킷 (NetEnvelope / Custom)
+        InternalCmd                      cmd;       // 내부 명령 (SkillCmd / MoveField / Enter·LeaveField)
+        std::chrono::steady_clock::time_point enqueuedAt{};   // control 레인 push 시각 (대기 시간 측정용)
     };
 
     class Worker {
     public:
         using Ptr = std::shared_ptr<Worker>;
         using Callback = std::function<void(const NetMessage&)>;
+        using TickCallback = std::function<void(float dt)>;
+        // bulk 메시지의 합치기 키 (0 = 합치지 않음). 같은 키는 한 묶음 안에서 마지막 것만 처리
+        //  - 소비자 스레드에서 호출. 검증 후 msg 를 고쳐 써도 된다 (예: type 을 MoveField 로)
+        using CollapseKeyFn = std::function<std::uint64_t(NetMessage&)>;
 
-        explicit Worker(std::string name);
+        static constexpr std::size_t kDefaultMailboxCapacity = 16384;
+        // 메일박스가 가득 찼을 때 생산자가 양보하며 다시 시도하는 최대 횟수 (넘으면 bulk 는 세션별 spill, control 은 overflow 로)
+        static constexpr int kPushRetries = 64;
+
+        // 메일박스 레인
+        //  - Control : 입장/퇴장/스킬/끊김 등. 먼저, 많이 꺼낸다
+        //  - Bulk    : 이동 입력 (Custom/MoveField). 밀리면 같은 플레이어 것은 최신만 남긴다
+        //  - 서버가 정한 좌표 이동(MovePosData)은 다음 입력이 덮지 않으므로 control
+        enum class Lane : std::uint8_t { Control = 0, Bulk = 1 };
+        static Lane LaneOf(const NetMessage& msg) {
+            if (std::holds_alternative<MovePosData>(msg.cmd)) return Lane::Control;
+            return (msg.type == MessageType::Custom || msg.type == MessageType::MoveField) ? Lane::Bulk : Lane::Control;
+        }
+
+        // 한 바퀴에 control 최대 kControlQuantum 개, bulk 최대 kBulkQuantum 개 (4:1 가중)
+        //  - bulk 가 아무리 쌓여도 control 은 bulk 한 묶음 뒤에 바로 처리된다
+        //  - control 이 계속 와도 bulk 는 매 바퀴 조금씩 진행된다
+        static constexpr std::size_t kControlQuantum = 256;
+        static constexpr std::size_t kBulkQuantum = 64;
+
+        // 세션 순서: 같은 세션 메시지가 한 레인에 남아 있는 동안은 새 메시지도 그 레인으로 (레인을 건너 앞지르지 않는다)
+        //  - bulk 에 남은 이동이 있으면 스킬 등 control 도 bulk 뒤에 붙고, control 이 남아 있으면 이동도 control 로
+        //  - 세션 핸들 index 를 kOrderBuckets 칸으로 나눠 센다 (겹친 세션은 우선순위만 잠깐 잃는다)
+        static constexpr std::size_t kOrderBuckets = 4096;
+
+
+        // 메일박스 경합/배치 통계 (소비자 스레드가 갱신, 어디서나 읽기 가능)
+        struct MailboxStats {
+            std::uint64_t drained{ 0 };     // 처리한 메시지 수
+            std::uint64_t batches{ 0 };     // 한 번 깨어나 연속 처리한 묶음 수
+            std::uint64_t parks{ 0 };       // 큐가 비어 잠든 횟수
+            std::uint64_t full_waits{ 0 };  // 메일박스가 가득 차 생산자가 기다린 횟수
+            std::uint64_t bulk_spilled{ 0 };    // bulk 레인이 계속 가득 차 세션별 spill 로 간 이동 입력 수
+            std::uint64_t overflowed{ 0 };      // control 레인이 가득 차 overflow 목록으로 간 수
+            std::uint64_t ticks{ 0 };       // 실행한 고정 스텝 틱 수
+            std::uint64_t ticks_skipped{ 0 };   // 정책에 따라 버린 마감 수
+            std::uint64_t ticks_caught_up{ 0 }; // 밀려서 쉬지 않고 바로 이어 돌린 틱 수
+            std::uint64_t collapsed{ 0 };   // bulk 레인에서 최신 입력에 합쳐 버린 수
+        };
+
+        explicit Worker(std::string name, std::size_t mailboxCapacity = kDefaultMailboxCapacity);
         virtual ~Worker();
 
 
         void start();
         void stop();
 
-  
-        INT32 GetMessageCount();
+        // 락 없이 읽는 근사치
+        INT32 GetMessageCount() const;
+
+        MailboxStats mailbox_stats() const;
+        void log_mailbox_stats() const;
 
 
         void push(NetMessage msg);
 
 
+        // start() 전에만 (스레드가 도는 중에 바꾸면 경합). 시작 후 호출은 무시
         void set_on_message(Callback cb);
 
+        // 지금 이 스레드가 처리 중인 control 메시지의 push 시각 (on_message 안에서만 의미 있음)
+        static std::chrono::steady_clock::time_point current_enqueued_at();
+
+        // bulk 레인 합치기 키 (start() 전에 설정, 없으면 합치지 않음)
+        void set_collapse_key(CollapseKeyFn fn) { collapse_key_ = std::move(fn); }
+
+        // 워커 스레드(스케줄러면 첫 조각을 돈 풀 스레드)에서 메시지/틱보다 먼저 1회 호출
+        //  - 큰 상태는 여기서 만들면 그 스레드가 도는 NUMA 노드 메모리에 잡힌다 (first-touch)
+        void set_on_start(std::function<void()> cb) { on_start_ = std::move(cb); }
+
+        // 전용 스레드를 cores 에 고정 (start() 이후. 스케줄러 워커는 풀 쪽에서 고정하므로 false)
+        bool set_affinity(const CoreSet& cores);
+
+        // 고정 스텝 틱을 메일박스와 같은 스레드에서 돌린다 (start() 전에 설정)
+        //  - 매 반복: 메일박스를 drainBudget 개까지 처리 -> 마감이 지났으면 cb(period) 1회 -> 다음 마감까지 잠듦
+        //  - 마감은 절대 시각으로 이어 붙이므로 (next += period) 처리 시간만큼 밀리지 않는다
+        //  - 잠든 동안 메시지가 오면 깨어나 처리하고 다시 잔다
+        void set_tick(std::chrono::microseconds period, TickCallback cb, std::size_t drainBudget = 256);
+
+        // 틱 정책 (start() 전에 설정, 설정 "tick" 섹션)
+        //  - catch_up: 틱이 다음 마감을 넘기면 max_catch_up 개까지 쉬지 않고 이어서 / skip: 밀린 마감은 버림
+        //  - spin_margin_us: 마감 직전 이 구간은 잠들지 않고 양보 spin (OS 타이머 오차 보정)
+        void set_tick_policy(const config::TickConfig& cfg);
+
+        // 전용 스레드 대신 FieldScheduler 풀에서 돌린다 (start() 전에 설정)
+        //  - 한 번에 한 풀 스레드만 이 워커를 실행하므로 단일 스레드 소유는 그대로
+        void set_scheduler(FieldScheduler* scheduler) { scheduler_ = scheduler; }
+
         const std::string& name() const { return name_; }
 
         std::thread::native_handle_type native_handle() {
@@ -64,21 +188,128 @@ namespace core {
         }
 
     private:
-        void loop(); //   
+        friend class FieldScheduler;
+
+        // 스케줄러 상태 (scheduler_ 가 있을 때만 사용)
+        enum class SchedState : std::uint8_t { Idle, Queued, Running, Detached };
+
+        // 한 조각 실행 결과
+        struct Slice {
+            std::size_t   drained{ 0 };
+            bool          ticked{ false };
+            std::int64_t  tickLateUs{ 0 };   // 틱을 돌렸다면 마감 대비 늦은 시간
+        };
+
+        // 메시지 budget 개 + 마감 지난 틱 1회. 전용 스레드 루프와 FieldScheduler 가 같이 쓴다
+        Slice run_slice(std::size_t budget);
+
+        // 두 레인을 가중치대로 번갈아 budget 개까지 꺼낸다 (합쳐 버린 것도 개수에 포함)
+        std::size_t drain_lanes(std::size_t budget);
+        std::size_t drain_bulk(std::size_t maxCount);
+        void deliver(NetMessage& msg);
+
+        bool mailbox_empty() const {
+            return mailbox_.empty_approx() && bulk_.empty_approx()
+                && !hasOverflow_.load(std::memory_order_acquire) && !hasBulkSpill_.load(std::memory_order_acquire);
+        }
+        bool try_push_lane(MpscQueue<NetMessage>& lane, NetMessage& msg);
+        void push_overflow(NetMessage&& msg);
+        std::size_t drain_overflow();
+        bool push_bulk_spill(NetMessage&& msg);
+        std::size_t drain_bulk_spill();
+        Lane route_lane(const NetMessage& msg);
+        void order_done(const NetMessage& msg, Lane lane);
+        void deliver_bulk(NetMessage& msg);
+        void deliver_control(NetMessage& msg);
+
+        void loop(); // 내부 스레드 루프
+        void run_tick(std::chrono::steady_clock::time_point now, std::int64_t lateUs);
+        void park_until(std::chrono::steady_clock::time_point deadline);
+        void wake();
 
         std::string              name_;
         std::atomic<bool>        running_{ false };
         std::thread              thread_;
 
-        std::mutex               mutex_;
-        std::condition_variable  cv_;
-        std::queue<NetMessage>   queue_;
+        // 여러 스레드가 넣고 이 워커 스레드 하나만 꺼낸다
+        MpscQueue<NetMessage>    mailbox_;   // Control 레인
+        MpscQueue<NetMessage>    bulk_;      // Bulk 레인
+
+        // control 레인이 가득 찼을 때 (드묾). 비어 있지 않은 동안은 control push 가 모두 여기로 (순서 유지)
+        std::mutex                 overflowMutex_;
+        std::deque<NetMessage>     overflow_;        // overflowMutex_ 보호
+        std::deque<NetMessage>     overflowBatch_;   // 소비자 전용
+        std::atomic<bool>          hasOverflow_{ false };
+
+        // bulk 레인이 가득 찼을 때: 세션마다 최신 이동 입력 하나만 (정지 입력도 버리지 않고, 메모리는 세션 수로 묶인다)
+        //  - 세션 순서 때문에 bulk 로 온 control 은 덮지 않고 그 자리에 둔다
+        //  - 비어 있지 않은 동안은 bulk push 가 모두 여기로 (레인에 남은 것보다 항상 새것)
+        //  - bulk 레인을 다 비운 뒤에만 꺼낸다
+        std::mutex                                                 bulkSpillMutex_;
+        std::unordered_map<std::uint64_t, std::vector<NetMessage>> bulkSpill_;        // bulkSpillMutex_ 보호 (세션 핸들 -> 순서대로)
+        std::vector<NetMessage>                                    bulkSpillBatch_;   // 소비자 전용
+        std::atomic<bool>                             hasBulkSpill_{ false };
+
+        // 세션 칸별로 각 레인에 남은 메시지 수 (push 에서 올리고 처리한 뒤 내린다)
+        std::array<std::atomic<std::uint32_t>, kOrderBuckets> pendingControl_{};
+        std::array<std::atomic<std::uint32_t>, kOrderBuckets> pendingBulk_{};
+
+        CollapseKeyFn                     collapse_key_;
+        std::vector<NetMessage>           bulkBatch_;   // 소비자 전용 재사용 버퍼
+        std::vector<std::uint64_t>        bulkKeys_;
+        std::unordered_set<std::uint64_t> bulkSeen_;
+
+        // 큐가 비었을 때만 잠든다. 생산자는 parked_ 일 때만 락을 잡고 깨운다
+        std::mutex                 parkMutex_;
+        std::condition_variable    parkCv_;
+        std::uint32_t              wakeEpoch_{ 0 };   // parkMutex_ 보호
+        alignas(64) std::atomic<bool> parked_{ false };
+
+        std::atomic<std::uint64_t> drained_{ 0 };
+        std::atomic<std::uint64_t> batches_{ 0 };
+        std::atomic<std::uint64_t> parks_{ 0 };
+        std::atomic<std::uint64_t> fullWaits_{ 0 };
+        std::atomic<std::uint64_t> bulkSpilled_{ 0 };
+        std::atomic<std::uint64_t> overflowed_{ 0 };
+        std::atomic<std::uint64_t> ticks_{ 0 };
+        std::atomic<std::uint64_t> ticksSkipped_{ 0 };
+        std::atomic<std::uint64_t> ticksCaughtUp_{ 0 };
+        std::atomic<std::uint64_t> collapsed_{ 0 };
+        TickHistogram              controlWait_;   // control 레인 push -> 처리 시작 대기
+        TickHistogram              tickLate_;      // 틱 마감 대비 실제 시작 지연
+        TickHistogram              tickOverrun_;   // 틱 콜백 수행 시간이 주기를 넘은 양 (안 넘으면 0)
+
         Callback                 on_message_;
+        std::function<void()>    on_start_;
+        bool                     startedOnThread_{ false };   // on_start_ 호출 여부 (소유 스레드 전용)
+
+        TickCallback                          on_tick_;
+        std::chrono::microseconds             tickPeriod_{ 0 };
+        std::size_t                           drainBudget_{ SIZE_MAX };
+        std::chrono::steady_clock::time_point nextTick_{};
+        bool                                  ticking_{ false };
+        bool                                  tickSkipLate_{ false };
+        int                                   tickMaxCatchUp_{ 5 };
+        std::int64_t                          tickCatchUpRun_{ 0 };   // 이번에 밀린 구간에서 이미 따라잡은 틱 수 (제때 끝나면 0)
+        std::chrono::microseconds             tickSpinMargin_{ 1000 };
+
+        FieldScheduler*                       scheduler_{ nullptr };
+        std::atomic<SchedState>               schedState_{ SchedState::Idle };
+        std::chrono::steady_clock::time_point armedDeadline_{};   // 스케줄러 타이머에 걸어둔 마감 (스케줄러 락 보호)
     };
     inline constexpr char GAME_WORKER_NAME[] = "GameWorker";
 
-    Worker::Ptr  GetGameWorker();         
-    bool         CreateGameWorker();      
-    bool         SendToGameWorker(NetMessage msg);
+    // GameWorker 샤드 (0번 = GAME_WORKER_NAME, 나머지 = "GameWorker#i")
+    //  - 세션 ID % 샤드 수 로 고정 배정 -> 한 세션의 패킷은 항상 같은 샤드에서 순서대로 처리
+    //  - 샤드 구성은 TcpServer 시작 전에 한 번만 만든다 (이후 조회는 락 없음)
+    Worker::Ptr  GetGameWorker();         // 0번 샤드
+    Worker*      GameWorkerFor(std::uint64_t sessionId);
+    int          GameWorkerCount();
+    bool         CreateGameWorker(Worker::Callback onMessage, const CoreSet& cores = {});
+    // shards 개 생성 (on_message 는 시작 전에 모든 샤드에 설정, 샤드 스레드는 cores 안에 나눠 고정)
+    //  - onMessage 가 비어 있으면 만들지 않는다 (시작 뒤에 핸들러를 다는 경합을 막는다)
+    bool         CreateGameWorkers(int shards, Worker::Callback onMessage, const CoreSet& cores = {});
+    bool         SendToGameWorker(std::uint64_t sessionId, NetMessage msg);
+    void         LogGameWorkerStats();
 
 } // namespace core
@@ -28,7 +28,7 @@ namespace core {
     
         static WorkerManager& instance();
 
-        // Ŀ /ȸ/
+        // 워커 등록/조회/정지
         bool insert(const key_type& key, Worker::Ptr worker);
         Worker::Ptr get(const key_type& key);
         void remove(const key_type& key);